@@ -0,0 +1,1190 @@
+// Бенчмарк SimpleVector и SingleLinkedList в сравнении с std::vector и std::forward_list.
+//
+// Сборка:  g++ -std=c++17 -O2 -DNDEBUG -pthread benchmark.cpp -o benchmark -latomic
+// Запуск:  ./benchmark [--max-size=N] [--filter=подстрока]
+//
+// Для каждой операции печатается время на операцию, число аллокаций на операцию,
+// промахи кэша на операцию (если доступен perf_event_open) и пиковый RSS процесса.
+
+#include "../simple_vector/simple_vector.cpp"
+#include "../single_linked_list/single_linked_list.cpp"
+#include "../single_linked_list/concurrent_single_linked_list.h"
+#include "../single_linked_list/intrusive_single_linked_list.h"
+#include "../single_linked_list/slab_allocator.h"
+#include "../single_linked_list/thread_pool.h"
+#include "../single_linked_list/unrolled_linked_list.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <forward_list>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <sys/resource.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// Подсчёт аллокаций: глобальные operator new/delete заменены на обёртки над malloc/free.
+// GCC не видит, что замена согласованная, и ругается на free() для памяти из operator new
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+std::atomic<std::size_t> allocation_count{0};
+}
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t alignment = static_cast<std::size_t>(align);
+    const std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    if (void* ptr = std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return operator new(size, align);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+namespace bench {
+
+constexpr std::size_t kDefaultMaxSize = 1'000'000;
+constexpr std::size_t kLimitMaxSize = 100'000'000;
+
+// Сколько вставок/удалений делается в операциях insert_*/erase_*:
+// у вектора вставка в начало стоит O(n), поэтому все n операций на больших размерах не выполнить
+constexpr std::size_t kEditOps = 1000;
+
+template <typename T>
+void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Тип, который можно только перемещать
+class MoveOnly {
+public:
+    MoveOnly() = default;
+
+    explicit MoveOnly(int value) : value_(std::make_unique<int>(value)) {
+    }
+
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly& operator=(const MoveOnly&) = delete;
+    MoveOnly(MoveOnly&&) noexcept = default;
+    MoveOnly& operator=(MoveOnly&&) noexcept = default;
+
+    [[nodiscard]] int Get() const noexcept {
+        return value_ ? *value_ : 0;
+    }
+
+private:
+    std::unique_ptr<int> value_;
+};
+
+bool operator==(const MoveOnly& lhs, const MoveOnly& rhs) {
+    return lhs.Get() == rhs.Get();
+}
+
+bool operator!=(const MoveOnly& lhs, const MoveOnly& rhs) {
+    return !(lhs == rhs);
+}
+
+bool operator<(const MoveOnly& lhs, const MoveOnly& rhs) {
+    return lhs.Get() < rhs.Get();
+}
+
+template <typename T>
+std::string_view TypeName() {
+    if constexpr (std::is_same_v<T, int>) {
+        return "int";
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return "string";
+    } else {
+        return "move_only";
+    }
+}
+
+template <typename T>
+T MakeValue(std::size_t i) {
+    if constexpr (std::is_same_v<T, int>) {
+        return static_cast<int>(i);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        // Длиннее буфера SSO, чтобы строка жила в куче
+        std::string result(32, 'x');
+        result += std::to_string(i);
+        return result;
+    } else {
+        return T(static_cast<int>(i));
+    }
+}
+
+inline std::size_t Weight(int value) {
+    return static_cast<std::size_t>(value);
+}
+
+inline std::size_t Weight(const std::string& value) {
+    return value.size() + static_cast<unsigned char>(value.back());
+}
+
+inline std::size_t Weight(const MoveOnly& value) {
+    return static_cast<std::size_t>(value.Get());
+}
+
+// Аппаратный счётчик через perf_event_open. Если системный вызов недоступен,
+// счётчик помечается как недоступный и в отчёте выводится "n/a".
+// Счётчик наследуется потоками, созданными после его открытия, поэтому в многопоточных
+// замерах учитываются и рабочие потоки. Потоки, завершившиеся до Stop (churn_4_threads),
+// добавляют свой счёт к общему при выходе; живые потоки пула GetBenchPool (замеры parallel_*)
+// включаются, потому что Start, Stop и чтение счётчика распространяются на всех наследников.
+// Поэтому счётчик должен быть открыт до создания пула и до запуска любых других потоков
+class PerfCounter {
+public:
+    explicit PerfCounter(std::uint64_t config) {
+#ifdef __linux__
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.inherit = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+        (void)config;
+#endif
+    }
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    ~PerfCounter() {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+#endif
+    }
+
+    [[nodiscard]] bool IsAvailable() const noexcept {
+        return fd_ >= 0;
+    }
+
+    void Start() noexcept {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    std::uint64_t Stop() noexcept {
+        std::uint64_t value = 0;
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+                value = 0;
+            }
+        }
+#endif
+        return value;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+// Возвращает память, освобождённую контейнерами предыдущего замера, операционной системе
+void TrimHeap() {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
+// Сбрасывает пиковый RSS процесса до текущего (Linux >= 4.0)
+void ResetPeakRss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs) {
+        clear_refs << "5";
+    }
+}
+
+// Пиковый RSS в килобайтах
+std::size_t PeakRssKb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+    }
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::size_t>(usage.ru_maxrss);
+}
+
+struct Case {
+    std::string_view container;
+    std::string_view type;
+    std::string_view op;
+    std::size_t size = 0;
+};
+
+class Bench {
+public:
+    explicit Bench(std::string filter)
+        : filter_(std::move(filter))
+#ifdef __linux__
+        , cache_misses_(PERF_COUNT_HW_CACHE_MISSES)
+#else
+        , cache_misses_(0)
+#endif
+    {
+        std::printf("%-26s %-10s %-28s %11s %12s %10s %14s %12s\n",
+                    "container", "type", "op", "size", "ns/op", "allocs/op", "cache-miss/op", "peak RSS MB");
+    }
+
+    // setup() готовит состояние вне замера, body(state) измеряется и выполняет ops операций
+    template <typename Setup, typename Body>
+    void Run(const Case& info, std::size_t ops, Setup&& setup, Body&& body) {
+        if (!IsSelected(info)) {
+            return;
+        }
+
+        TrimHeap();
+        ResetPeakRss();
+        auto state = setup();
+
+        const std::size_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+        cache_misses_.Start();
+        const auto start = std::chrono::steady_clock::now();
+
+        body(state);
+
+        const auto finish = std::chrono::steady_clock::now();
+        const std::uint64_t misses = cache_misses_.Stop();
+        const std::size_t allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+
+        const double count = static_cast<double>(ops == 0 ? 1 : ops);
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+
+        char misses_text[32] = "n/a";
+        if (cache_misses_.IsAvailable()) {
+            std::snprintf(misses_text, sizeof(misses_text), "%.3f", static_cast<double>(misses) / count);
+        }
+
+        std::printf("%-26.*s %-10.*s %-28.*s %11zu %12.2f %10.3f %14s %12.1f\n",
+                    static_cast<int>(info.container.size()), info.container.data(),
+                    static_cast<int>(info.type.size()), info.type.data(),
+                    static_cast<int>(info.op.size()), info.op.data(),
+                    info.size, ns / count, static_cast<double>(allocations) / count,
+                    misses_text, static_cast<double>(PeakRssKb()) / 1024.0);
+        std::fflush(stdout);
+    }
+
+private:
+    [[nodiscard]] bool IsSelected(const Case& info) const {
+        if (filter_.empty()) {
+            return true;
+        }
+        std::string name;
+        name.append(info.container).append("/").append(info.type).append("/").append(info.op);
+        return name.find(filter_) != std::string::npos;
+    }
+
+    std::string filter_;
+    PerfCounter cache_misses_;
+};
+
+// Единый интерфейс к сравниваемым контейнерам
+
+template <typename T, typename Value>
+void PushBack(std::vector<T>& c, Value&& value) {
+    c.push_back(std::forward<Value>(value));
+}
+
+template <typename T, typename Value>
+void PushBack(SimpleVector<T>& c, Value&& value) {
+    c.PushBack(std::forward<Value>(value));
+}
+
+template <typename T>
+void Reserve(std::vector<T>& c, std::size_t capacity) {
+    c.reserve(capacity);
+}
+
+template <typename T>
+void Reserve(SimpleVector<T>& c, std::size_t capacity) {
+    c.Reserve(capacity);
+}
+
+template <typename T>
+std::size_t Size(const std::vector<T>& c) {
+    return c.size();
+}
+
+template <typename T>
+std::size_t Size(const SimpleVector<T>& c) {
+    return c.GetSize();
+}
+
+template <typename T, typename Value>
+void Insert(std::vector<T>& c, std::size_t index, Value&& value) {
+    c.insert(c.begin() + index, std::forward<Value>(value));
+}
+
+template <typename T, typename Value>
+void Insert(SimpleVector<T>& c, std::size_t index, Value&& value) {
+    c.Insert(c.begin() + index, std::forward<Value>(value));
+}
+
+template <typename T>
+void Erase(std::vector<T>& c, std::size_t index) {
+    c.erase(c.begin() + index);
+}
+
+template <typename T>
+void Erase(SimpleVector<T>& c, std::size_t index) {
+    c.Erase(c.begin() + index);
+}
+
+template <typename T, typename A, typename Value>
+void PushFront(std::forward_list<T, A>& c, Value&& value) {
+    c.push_front(std::forward<Value>(value));
+}
+
+template <typename T, typename A, typename Value>
+void PushFront(SingleLinkedList<T, A>& c, Value&& value) {
+    c.PushFront(std::forward<Value>(value));
+}
+
+template <typename T, size_t B, typename Value>
+void PushFront(UnrolledLinkedList<T, B>& c, Value&& value) {
+    c.PushFront(std::forward<Value>(value));
+}
+
+template <typename T, typename A>
+auto BeforeBegin(std::forward_list<T, A>& c) {
+    return c.before_begin();
+}
+
+template <typename T, typename A>
+auto BeforeBegin(SingleLinkedList<T, A>& c) {
+    return c.before_begin();
+}
+
+template <typename T, size_t B>
+auto BeforeBegin(UnrolledLinkedList<T, B>& c) {
+    return c.before_begin();
+}
+
+template <typename T, typename A, typename Value>
+auto InsertAfter(std::forward_list<T, A>& c, typename std::forward_list<T, A>::iterator pos, Value&& value) {
+    return c.insert_after(pos, std::forward<Value>(value));
+}
+
+template <typename T, typename A, typename Value>
+auto InsertAfter(SingleLinkedList<T, A>& c, typename SingleLinkedList<T, A>::Iterator pos, Value&& value) {
+    return c.InsertAfter(pos, std::forward<Value>(value));
+}
+
+template <typename T, size_t B, typename Value>
+auto InsertAfter(UnrolledLinkedList<T, B>& c, typename UnrolledLinkedList<T, B>::Iterator pos, Value&& value) {
+    return c.InsertAfter(pos, std::forward<Value>(value));
+}
+
+template <typename T, typename A>
+void EraseAfter(std::forward_list<T, A>& c, typename std::forward_list<T, A>::iterator pos) {
+    c.erase_after(pos);
+}
+
+template <typename T, typename A>
+void EraseAfter(SingleLinkedList<T, A>& c, typename SingleLinkedList<T, A>::Iterator pos) {
+    c.EraseAfter(pos);
+}
+
+template <typename T, size_t B>
+void EraseAfter(UnrolledLinkedList<T, B>& c, typename UnrolledLinkedList<T, B>::Iterator pos) {
+    c.EraseAfter(pos);
+}
+
+template <typename T, typename A>
+void Sort(std::forward_list<T, A>& c) {
+    c.sort();
+}
+
+template <typename T, typename A>
+void Sort(SingleLinkedList<T, A>& c) {
+    c.Sort();
+}
+
+template <typename T, typename A>
+void Reverse(std::forward_list<T, A>& c) {
+    c.reverse();
+}
+
+template <typename T, typename A>
+void Reverse(SingleLinkedList<T, A>& c) {
+    c.Reverse();
+}
+
+template <typename T, typename A>
+void Merge(std::forward_list<T, A>& c, std::forward_list<T, A>& other) {
+    c.merge(other);
+}
+
+template <typename T, typename A>
+void Merge(SingleLinkedList<T, A>& c, SingleLinkedList<T, A>& other) {
+    c.Merge(other);
+}
+
+template <typename T, typename A>
+void Unique(std::forward_list<T, A>& c) {
+    c.unique();
+}
+
+template <typename T, typename A>
+void Unique(SingleLinkedList<T, A>& c) {
+    c.Unique();
+}
+
+template <typename T, typename A, typename Predicate>
+void RemoveIf(std::forward_list<T, A>& c, Predicate pred) {
+    c.remove_if(pred);
+}
+
+template <typename T, typename A, typename Predicate>
+void RemoveIf(SingleLinkedList<T, A>& c, Predicate pred) {
+    c.RemoveIf(pred);
+}
+
+template <typename Container>
+struct IsSingleLinkedList : std::false_type {
+};
+
+template <typename T, typename A>
+struct IsSingleLinkedList<SingleLinkedList<T, A>> : std::true_type {
+};
+
+// Состояния замеров
+
+template <typename Container>
+struct CopyState {
+    Container source;
+    std::optional<Container> copy;
+};
+
+template <typename Container>
+struct PairState {
+    Container lhs;
+    Container rhs;
+};
+
+// Список и итератор на элемент с номером offset - 1 (before_begin при offset == 0)
+template <typename Container>
+struct ListCursor {
+    template <typename Make>
+    ListCursor(Make make, std::size_t offset)
+        : list(make())
+        , pos(BeforeBegin(list)) {
+        std::advance(pos, offset);
+    }
+
+    Container list;
+    decltype(BeforeBegin(std::declval<Container&>())) pos;
+};
+
+template <typename Container, typename T>
+Container MakeFilledVector(std::size_t n) {
+    Container c;
+    for (std::size_t i = 0; i < n; ++i) {
+        PushBack(c, MakeValue<T>(i));
+    }
+    return c;
+}
+
+template <typename Container, typename T>
+void FillList(Container& c, std::size_t n) {
+    auto tail = BeforeBegin(c);
+    for (std::size_t i = 0; i < n; ++i) {
+        tail = InsertAfter(c, tail, MakeValue<T>(i));
+    }
+}
+
+template <typename Container, typename T>
+Container MakeFilledList(std::size_t n) {
+    Container c;
+    FillList<Container, T>(c, n);
+    return c;
+}
+
+template <typename Container, typename T>
+Container MakeFilledList(std::size_t n, const typename Container::allocator_type& alloc) {
+    Container c(alloc);
+    FillList<Container, T>(c, n);
+    return c;
+}
+
+// Удаляет каждый второй элемент, затем вставляет новый после каждого оставшегося:
+// освобождённые узлы перемешиваются, и порядок узлов в памяти перестаёт совпадать с порядком в списке.
+// Возвращает число выполненных вставок и удалений
+template <typename Container, typename T>
+std::size_t Churn(Container& c, std::size_t n) {
+    std::size_t ops = 0;
+    for (auto pos = c.begin(); pos != c.end() && std::next(pos) != c.end(); ++pos, ++ops) {
+        EraseAfter(c, pos);
+    }
+    for (auto pos = c.begin(); pos != c.end(); ++pos, ++ops) {
+        pos = InsertAfter(c, pos, MakeValue<T>(n + ops));
+    }
+    return ops;
+}
+
+// Список из n элементов в перемешанном порядке, каждое значение встречается дважды подряд
+template <typename Container, typename T>
+Container MakeShuffledList(std::size_t n) {
+    Container c;
+    auto tail = BeforeBegin(c);
+    for (std::size_t i = 0; i < n; ++i) {
+        tail = InsertAfter(c, tail, MakeValue<T>((i / 2) * 2654435761u % n));
+    }
+    return c;
+}
+
+template <typename Container>
+std::size_t Traverse(const Container& c) {
+    std::size_t sum = 0;
+    for (const auto& value : c) {
+        sum += Weight(value);
+    }
+    return sum;
+}
+
+// Операции, общие для векторов и списков
+template <typename Container, typename T, typename Make>
+void RunCommonOps(Bench& bench, std::string_view container, std::size_t n, Make make) {
+    const std::string_view type = TypeName<T>();
+
+    bench.Run({container, type, "iterate", n}, n, make, [](Container& c) {
+        DoNotOptimize(Traverse(c));
+    });
+
+    if constexpr (std::is_copy_constructible_v<T>) {
+        bench.Run({container, type, "copy", n}, n,
+                  [&] { return CopyState<Container>{make(), std::nullopt}; },
+                  [](CopyState<Container>& state) {
+                      state.copy.emplace(state.source);
+                      DoNotOptimize(state.copy);
+                  });
+    }
+
+    bench.Run({container, type, "compare", n}, n,
+              [&] { return PairState<Container>{make(), make()}; },
+              [](PairState<Container>& state) {
+                  DoNotOptimize(state.lhs == state.rhs);
+              });
+
+    bench.Run({container, type, "destroy", n}, n,
+              [&] { return std::unique_ptr<Container>(new Container(make())); },
+              [](std::unique_ptr<Container>& c) {
+                  c.reset();
+              });
+}
+
+template <typename Container, typename T>
+void RunVectorSuite(Bench& bench, std::string_view container, std::size_t n) {
+    const std::string_view type = TypeName<T>();
+    const std::size_t edits = std::min(n, kEditOps);
+    auto empty = [] { return Container(); };
+    auto filled = [n] { return MakeFilledVector<Container, T>(n); };
+
+    if constexpr (std::is_copy_constructible_v<T>) {
+        const T prototype = MakeValue<T>(n);
+        bench.Run({container, type, "push_back", n}, n, empty, [&](Container& c) {
+            for (std::size_t i = 0; i < n; ++i) {
+                PushBack(c, prototype);
+            }
+        });
+        // SimpleVector::Reserve копирует элементы, поэтому для move-only типов не собирается
+        bench.Run({container, type, "reserve+emplace_back", n}, n, empty, [&](Container& c) {
+            Reserve(c, n);
+            for (std::size_t i = 0; i < n; ++i) {
+                PushBack(c, MakeValue<T>(i));
+            }
+        });
+    }
+    bench.Run({container, type, "emplace_back", n}, n, empty, [&](Container& c) {
+        for (std::size_t i = 0; i < n; ++i) {
+            PushBack(c, MakeValue<T>(i));
+        }
+    });
+
+    bench.Run({container, type, "insert_front", n}, edits, filled, [&](Container& c) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            Insert(c, 0, MakeValue<T>(i));
+        }
+    });
+    bench.Run({container, type, "insert_middle", n}, edits, filled, [&](Container& c) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            Insert(c, Size(c) / 2, MakeValue<T>(i));
+        }
+    });
+    bench.Run({container, type, "insert_back", n}, edits, filled, [&](Container& c) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            Insert(c, Size(c), MakeValue<T>(i));
+        }
+    });
+
+    bench.Run({container, type, "erase_front", n}, edits, filled, [&](Container& c) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            Erase(c, 0);
+        }
+    });
+    bench.Run({container, type, "erase_middle", n}, edits, filled, [&](Container& c) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            Erase(c, Size(c) / 2);
+        }
+    });
+    bench.Run({container, type, "erase_back", n}, edits, filled, [&](Container& c) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            Erase(c, Size(c) - 1);
+        }
+    });
+
+    RunCommonOps<Container, T>(bench, container, n, filled);
+}
+
+template <typename Container, typename T>
+void RunListSuite(Bench& bench, std::string_view container, std::size_t n) {
+    using Cursor = ListCursor<Container>;
+    const std::string_view type = TypeName<T>();
+    const std::size_t edits = std::min(n, kEditOps);
+    // Удаляем только элементы после середины, чтобы их гарантированно хватило
+    const std::size_t erases = std::min(n / 2, kEditOps);
+    auto empty = [] { return Container(); };
+    auto filled = [n] { return MakeFilledList<Container, T>(n); };
+    auto cursor_at = [filled](std::size_t offset) {
+        return [filled, offset] { return Cursor(filled, offset); };
+    };
+
+    if constexpr (std::is_copy_constructible_v<T>) {
+        const T prototype = MakeValue<T>(n);
+        bench.Run({container, type, "push_front", n}, n, empty, [&](Container& c) {
+            for (std::size_t i = 0; i < n; ++i) {
+                PushFront(c, prototype);
+            }
+        });
+    }
+    bench.Run({container, type, "emplace_front", n}, n, empty, [&](Container& c) {
+        for (std::size_t i = 0; i < n; ++i) {
+            PushFront(c, MakeValue<T>(i));
+        }
+    });
+    // У std::forward_list нет push_back, хвост отслеживается итератором
+    bench.Run({container, type, "emplace_back", n}, n, cursor_at(0), [&](Cursor& state) {
+        auto tail = state.pos;
+        for (std::size_t i = 0; i < n; ++i) {
+            tail = InsertAfter(state.list, tail, MakeValue<T>(i));
+        }
+    });
+    if constexpr (IsSingleLinkedList<Container>::value) {
+        bench.Run({container, type, "push_back", n}, n, empty, [&](Container& c) {
+            for (std::size_t i = 0; i < n; ++i) {
+                c.PushBack(MakeValue<T>(i));
+            }
+        });
+    }
+
+    bench.Run({container, type, "insert_front", n}, edits, cursor_at(0), [&](Cursor& state) {
+        for (std::size_t i = 0; i < edits; ++i) {
+            InsertAfter(state.list, state.pos, MakeValue<T>(i));
+        }
+    });
+    // Вставка идёт после только что вставленного элемента: у UnrolledLinkedList вставка
+    // может сдвинуть элемент, на который указывал прежний итератор
+    bench.Run({container, type, "insert_middle", n}, edits, cursor_at(n / 2), [&](Cursor& state) {
+        auto pos = state.pos;
+        for (std::size_t i = 0; i < edits; ++i) {
+            pos = InsertAfter(state.list, pos, MakeValue<T>(i));
+        }
+    });
+    bench.Run({container, type, "insert_back", n}, edits, cursor_at(n), [&](Cursor& state) {
+        auto tail = state.pos;
+        for (std::size_t i = 0; i < edits; ++i) {
+            tail = InsertAfter(state.list, tail, MakeValue<T>(i));
+        }
+    });
+
+    bench.Run({container, type, "erase_front", n}, erases, cursor_at(0), [&](Cursor& state) {
+        for (std::size_t i = 0; i < erases; ++i) {
+            EraseAfter(state.list, state.pos);
+        }
+    });
+    bench.Run({container, type, "erase_middle", n}, erases, cursor_at(n / 2), [&](Cursor& state) {
+        for (std::size_t i = 0; i < erases; ++i) {
+            EraseAfter(state.list, state.pos);
+        }
+    });
+
+    bench.Run({container, type, "churn", n}, n, filled, [n](Container& c) {
+        DoNotOptimize(Churn<Container, T>(c, n));
+    });
+    bench.Run({container, type, "iterate_after_churn", n}, n,
+              [filled, n] {
+                  Container c = filled();
+                  Churn<Container, T>(c, n);
+                  return c;
+              },
+              [](Container& c) {
+                  DoNotOptimize(Traverse(c));
+              });
+    // Каждый поток работает со своим списком: показывает конкуренцию потоков внутри аллокатора
+    bench.Run({container, type, "churn_4_threads", n}, n,
+              [n] {
+                  std::vector<Container> lists;
+                  for (int i = 0; i < 4; ++i) {
+                      lists.push_back(MakeFilledList<Container, T>(n / 4));
+                  }
+                  return lists;
+              },
+              [n](std::vector<Container>& lists) {
+                  std::vector<std::thread> workers;
+                  for (Container& c : lists) {
+                      workers.emplace_back([&c, n] {
+                          DoNotOptimize(Churn<Container, T>(c, n));
+                      });
+                  }
+                  for (std::thread& worker : workers) {
+                      worker.join();
+                  }
+              });
+    // Один поток поочерёдно работает с несколькими списками: у каждого списка со SlabAllocator
+    // свой пул, и кэш потока должен держать блоки всех этих пулов сразу
+    bench.Run({container, type, "push_front_4_lists", n}, n,
+              [] {
+                  return std::vector<Container>(4);
+              },
+              [n](std::vector<Container>& lists) {
+                  for (std::size_t i = 0; i < n; ++i) {
+                      PushFront(lists[i % lists.size()], MakeValue<T>(i));
+                  }
+              });
+
+    // end() вычисляется на каждом шаге цикла
+    bench.Run({container, type, "iterate_explicit_end", n}, n, filled, [](Container& c) {
+        std::size_t sum = 0;
+        for (auto it = c.begin(); it != c.end(); ++it) {
+            sum += Weight(*it);
+        }
+        DoNotOptimize(sum);
+    });
+
+    RunCommonOps<Container, T>(bench, container, n, filled);
+}
+
+// Перестановки узлов: сортировка, разворот, слияние, удаление по условию
+template <typename Container, typename T>
+void RunListAlgorithms(Bench& bench, std::string_view container, std::size_t n) {
+    const std::string_view type = TypeName<T>();
+    auto shuffled = [n] { return MakeShuffledList<Container, T>(n); };
+    auto sorted = [n] { return MakeFilledList<Container, T>(n); };
+
+    bench.Run({container, type, "sort", n}, n, shuffled, [](Container& c) {
+        Sort(c);
+    });
+    // Как сортировали раньше: перенос в вектор, std::stable_sort и новый список
+    bench.Run({container, type, "sort_via_vector", n}, n, shuffled, [](Container& c) {
+        std::vector<T> values(std::make_move_iterator(c.begin()), std::make_move_iterator(c.end()));
+        std::stable_sort(values.begin(), values.end());
+        c = Container(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+    });
+    bench.Run({container, type, "reverse", n}, n, sorted, [](Container& c) {
+        Reverse(c);
+    });
+    bench.Run({container, type, "merge", n}, n,
+              [n] {
+                  // Узлы переносятся между списками, поэтому у них должен быть общий аллокатор
+                  typename Container::allocator_type alloc;
+                  return PairState<Container>{MakeFilledList<Container, T>(n / 2, alloc),
+                                              MakeFilledList<Container, T>(n - n / 2, alloc)};
+              },
+              [](PairState<Container>& state) {
+                  Merge(state.lhs, state.rhs);
+              });
+    bench.Run({container, type, "unique", n}, n, shuffled, [](Container& c) {
+        Unique(c);
+    });
+    bench.Run({container, type, "remove_if", n}, n, sorted, [](Container& c) {
+        RemoveIf(c, [](const T& value) {
+            return Weight(value) % 2 == 0;
+        });
+    });
+}
+
+// Список, отсортированный после заполнения в перемешанном порядке: соседние элементы
+// лежат в памяти далеко друг от друга
+template <typename Container, typename T>
+Container MakeScatteredList(std::size_t n) {
+    Container c = MakeShuffledList<Container, T>(n);
+    Sort(c);
+    return c;
+}
+
+// Пул для параллельных обходов создаётся один раз на весь бенчмарк
+inline ThreadPool& GetBenchPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+// Обходы SingleLinkedList с упреждающей загрузкой узлов и параллельные обходы против обычных циклов
+template <typename Container, typename T>
+void RunListTraversal(Bench& bench, std::string_view container, std::size_t n) {
+    const std::string_view type = TypeName<T>();
+    auto scattered = [n] { return MakeScatteredList<Container, T>(n); };
+    auto never = [](const T& value) {
+        return Weight(value) == static_cast<std::size_t>(-1);
+    };
+    auto next_value = [](const T& value) {
+        return MakeValue<T>(Weight(value) + 1);
+    };
+
+    bench.Run({container, type, "iterate_scattered", n}, n, scattered, [](Container& c) {
+        DoNotOptimize(Traverse(c));
+    });
+    bench.Run({container, type, "for_each_scattered", n}, n, scattered, [](Container& c) {
+        std::size_t sum = 0;
+        c.ForEach([&sum](const T& value) {
+            sum += Weight(value);
+        });
+        DoNotOptimize(sum);
+    });
+    bench.Run({container, type, "accumulate_scattered", n}, n, scattered, [](Container& c) {
+        DoNotOptimize(c.Accumulate(std::size_t{0}, [](std::size_t sum, const T& value) {
+            return sum + Weight(value);
+        }));
+    });
+    bench.Run({container, type, "std_find_if_scattered", n}, n, scattered, [never](Container& c) {
+        DoNotOptimize(std::find_if(c.begin(), c.end(), never) == c.end());
+    });
+    bench.Run({container, type, "find_if_scattered", n}, n, scattered, [never](Container& c) {
+        DoNotOptimize(c.FindIf(never) == c.end());
+    });
+    // Общая сумма на атомике замеряла бы борьбу потоков за одну кэш-линию, а не обход,
+    // поэтому каждый элемент читается независимо от остальных
+    bench.Run({container, type, "parallel_for_each_scattered", n}, n, scattered, [](Container& c) {
+        c.ParallelForEach(GetBenchPool(), [](const T& value) {
+            DoNotOptimize(Weight(value));
+        });
+    });
+    bench.Run({container, type, "transform_scattered", n}, n, scattered, [next_value](Container& c) {
+        for (T& value : c) {
+            value = next_value(value);
+        }
+    });
+    bench.Run({container, type, "parallel_transform_scattered", n}, n, scattered, [next_value](Container& c) {
+        c.ParallelTransform(GetBenchPool(), next_value);
+    });
+}
+
+// Элемент интрузивного списка: значение и крючок в одном объекте
+template <typename T>
+struct IntrusiveItem {
+    T value;
+    IntrusiveListHook hook;
+};
+
+// Объекты лежат в векторе и создаются вне замера, список их только связывает
+template <typename T>
+struct IntrusiveState {
+    using List = IntrusiveSingleLinkedList<IntrusiveItem<T>, &IntrusiveItem<T>::hook>;
+
+    explicit IntrusiveState(std::size_t n) {
+        items.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            items.push_back(IntrusiveItem<T>{MakeValue<T>(i), {}});
+        }
+    }
+
+    void Link() {
+        for (IntrusiveItem<T>& item : items) {
+            list.PushFront(item);
+        }
+    }
+
+    std::vector<IntrusiveItem<T>> items;
+    List list;
+};
+
+template <typename T>
+void RunIntrusiveSuite(Bench& bench, std::size_t n) {
+    const std::string_view container = "IntrusiveSingleLinkedList";
+    const std::string_view type = TypeName<T>();
+    auto unlinked = [n] { return IntrusiveState<T>(n); };
+    auto linked = [n] {
+        IntrusiveState<T> state(n);
+        state.Link();
+        return state;
+    };
+
+    bench.Run({container, type, "push_front", n}, n, unlinked, [](IntrusiveState<T>& state) {
+        state.Link();
+    });
+    bench.Run({container, type, "iterate", n}, n, linked, [](IntrusiveState<T>& state) {
+        std::size_t sum = 0;
+        for (const IntrusiveItem<T>& item : state.list) {
+            sum += Weight(item.value);
+        }
+        DoNotOptimize(sum);
+    });
+    bench.Run({container, type, "erase_front", n}, n, linked, [](IntrusiveState<T>& state) {
+        while (!state.list.IsEmpty()) {
+            state.list.PopFront();
+        }
+    });
+}
+
+// Общий для потоков SingleLinkedList под мьютексом: база для сравнения с ConcurrentSingleLinkedList
+template <typename T>
+class LockedSingleLinkedList {
+public:
+    void PushFront(const T& value) {
+        std::lock_guard guard(mutex_);
+        list_.PushFront(value);
+    }
+
+    bool TryPopFront(T& value) {
+        std::lock_guard guard(mutex_);
+        if (list_.IsEmpty()) {
+            return false;
+        }
+        value = *list_.begin();
+        list_.PopFront();
+        return true;
+    }
+
+    [[nodiscard]] std::size_t GetSize() const {
+        std::lock_guard guard(mutex_);
+        return list_.GetSize();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    SingleLinkedList<T> list_;
+};
+
+// Стресс-проверка и замер стека под нагрузкой: threads потоков поочерёдно кладут и снимают
+// элементы, всего n пар операций. После замера стек опустошается, и сумма и число снятых
+// значений сверяются с положенными: потерянный или выданный дважды элемент завершает бенчмарк
+template <typename Stack>
+void RunStackPushPop(Bench& bench, std::string_view container, std::size_t n, std::size_t threads) {
+    // Стек заполнен заранее, чтобы потоки не упирались в пустую вершину
+    constexpr std::uint64_t kPrefill = 1024;
+    const std::size_t per_thread = n / threads;
+    const std::string op = "push_pop_" + std::to_string(threads) + "_threads";
+
+    struct State {
+        std::unique_ptr<Stack> stack = std::make_unique<Stack>();
+        std::vector<std::uint64_t> popped_sums;
+        std::vector<std::uint64_t> popped_counts;
+    };
+
+    bench.Run({container, "uint64", op, n}, per_thread * threads * 2,
+              [threads] {
+                  State state;
+                  for (std::uint64_t value = 1; value <= kPrefill; ++value) {
+                      state.stack->PushFront(value);
+                  }
+                  state.popped_sums.assign(threads, 0);
+                  state.popped_counts.assign(threads, 0);
+                  return state;
+              },
+              [threads, per_thread](State& state) {
+                  std::atomic<bool> start{false};
+                  std::vector<std::thread> workers;
+                  for (std::size_t t = 0; t < threads; ++t) {
+                      workers.emplace_back([&state, &start, t, per_thread] {
+                          while (!start.load(std::memory_order_acquire)) {
+                              std::this_thread::yield();
+                          }
+                          const std::uint64_t first = kPrefill + 1 + t * per_thread;
+                          std::uint64_t sum = 0;
+                          std::uint64_t count = 0;
+                          std::uint64_t value = 0;
+                          for (std::uint64_t i = 0; i < per_thread; ++i) {
+                              state.stack->PushFront(first + i);
+                              if (state.stack->TryPopFront(value)) {
+                                  sum += value;
+                                  ++count;
+                              }
+                          }
+                          state.popped_sums[t] = sum;
+                          state.popped_counts[t] = count;
+                      });
+                  }
+                  start.store(true, std::memory_order_release);
+                  for (std::thread& worker : workers) {
+                      worker.join();
+                  }
+
+                  std::uint64_t sum = 0;
+                  std::uint64_t count = 0;
+                  for (std::size_t t = 0; t < threads; ++t) {
+                      sum += state.popped_sums[t];
+                      count += state.popped_counts[t];
+                  }
+                  for (std::uint64_t value = 0; state.stack->TryPopFront(value);) {
+                      sum += value;
+                      ++count;
+                  }
+                  const std::uint64_t pushed = kPrefill + threads * per_thread;
+                  if (count != pushed || sum != pushed * (pushed + 1) / 2 || state.stack->GetSize() != 0) {
+                      std::fprintf(stderr, "stack check failed: %zu threads, %llu of %llu values popped\n", threads,
+                                   static_cast<unsigned long long>(count), static_cast<unsigned long long>(pushed));
+                      std::exit(1);
+                  }
+              });
+}
+
+// Пропускная способность общего стека от 1 до 64 потоков
+void RunConcurrentStack(Bench& bench, std::size_t n) {
+    for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+        RunStackPushPop<ConcurrentSingleLinkedList<std::uint64_t>>(bench, "ConcurrentSingleLinkedList", n, threads);
+        RunStackPushPop<LockedSingleLinkedList<std::uint64_t>>(bench, "SingleLinkedList+mutex", n, threads);
+    }
+}
+
+template <typename T>
+void RunAll(Bench& bench, std::size_t n) {
+    RunVectorSuite<SimpleVector<T>, T>(bench, "SimpleVector", n);
+    RunVectorSuite<std::vector<T>, T>(bench, "std::vector", n);
+    RunListSuite<SingleLinkedList<T>, T>(bench, "SingleLinkedList", n);
+    RunListSuite<SingleLinkedList<T, SlabAllocator<T>>, T>(bench, "SingleLinkedList+slab", n);
+    RunListSuite<SingleLinkedList<T, SlabAllocator<T, true>>, T>(bench, "SingleLinkedList+slab_mt", n);
+    RunListAlgorithms<SingleLinkedList<T>, T>(bench, "SingleLinkedList", n);
+    RunListTraversal<SingleLinkedList<T>, T>(bench, "SingleLinkedList", n);
+    RunListAlgorithms<SingleLinkedList<T, SlabAllocator<T>>, T>(bench, "SingleLinkedList+slab", n);
+    RunListAlgorithms<std::forward_list<T>, T>(bench, "std::forward_list", n);
+    RunListSuite<UnrolledLinkedList<T>, T>(bench, "UnrolledLinkedList", n);
+    RunIntrusiveSuite<T>(bench, n);
+    RunListSuite<std::forward_list<T>, T>(bench, "std::forward_list", n);
+}
+
+} // namespace bench
+
+int main(int argc, char* argv[]) {
+    std::size_t max_size = bench::kDefaultMaxSize;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg.substr(0, 11) == "--max-size=") {
+            max_size = std::strtoull(argv[i] + 11, nullptr, 10);
+        } else if (arg.substr(0, 9) == "--filter=") {
+            filter = std::string(arg.substr(9));
+        } else {
+            std::fprintf(stderr, "Usage: %s [--max-size=N] [--filter=substring]\n", argv[0]);
+            return 1;
+        }
+    }
+    max_size = std::min(max_size, bench::kLimitMaxSize);
+
+    bench::Bench runner(filter);
+    for (std::size_t n = 1000; n <= max_size; n *= 10) {
+        bench::RunAll<int>(runner, n);
+        bench::RunAll<std::string>(runner, n);
+        bench::RunAll<bench::MoveOnly>(runner, n);
+        bench::RunConcurrentStack(runner, n);
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <cassert>
 #include <initializer_list>
+#include <stdexcept>
 #include "array_ptr.h"
 #include <algorithm>
 #include <string>
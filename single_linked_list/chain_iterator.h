@@ -0,0 +1,95 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Общие части односвязных списков SingleLinkedList и IntrusiveSingleLinkedList.
+// Список — это цепочка звеньев Link с полем next_node, начинающаяся с заголовка head_
+// и заканчивающаяся звеном tail_ (у пустого списка tail_ указывает на head_)
+
+// Прямой итератор по цепочке звеньев. Создавать итераторы из звеньев может только список List,
+// он же по звену находит значение: List::ValueOf(Link*)
+template <typename List, typename Link, typename ValueType>
+class ChainIterator {
+
+    friend List;
+
+    explicit ChainIterator(Link* node) noexcept : node_(node) {
+    }
+
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<ValueType>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType*;
+    using reference = ValueType&;
+
+    ChainIterator() = default;
+
+    ChainIterator(const ChainIterator<List, Link, value_type>& other) noexcept {
+        node_ = other.node_;
+    }
+
+    ChainIterator& operator=(const ChainIterator& rhs) = default;
+
+    [[nodiscard]] bool operator==(const ChainIterator<List, Link, const value_type>& rhs) const noexcept {
+        return node_ == rhs.node_;
+    }
+
+    [[nodiscard]] bool operator!=(const ChainIterator<List, Link, const value_type>& rhs) const noexcept {
+        return node_ != rhs.node_;
+    }
+
+    [[nodiscard]] bool operator==(const ChainIterator<List, Link, value_type>& rhs) const noexcept {
+        return node_ == rhs.node_;
+    }
+
+    [[nodiscard]] bool operator!=(const ChainIterator<List, Link, value_type>& rhs) const noexcept {
+        return node_ != rhs.node_;
+    }
+
+    ChainIterator& operator++() noexcept {
+        assert(node_ != nullptr);
+        node_ = node_->next_node;
+        return *this;
+    }
+
+    ChainIterator operator++(int) noexcept {
+        auto old_value(*this);
+        ++(*this);
+        return old_value;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+        assert(node_ != nullptr);
+        return *List::ValueOf(node_);
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+        assert(node_ != nullptr);
+        return List::ValueOf(node_);
+    }
+
+private:
+    template <typename, typename, typename>
+    friend class ChainIterator;
+
+    Link* node_ = nullptr;
+};
+
+// Обменивает цепочки двух списков вместе с хвостами. Хвост пустого списка указывает
+// на его собственный заголовок, поэтому после обмена такой хвост перенаправляется
+template <typename Link>
+void SwapChains(Link& lhs_head, Link*& lhs_tail, Link& rhs_head, Link*& rhs_tail) noexcept {
+    std::swap(lhs_head.next_node, rhs_head.next_node);
+    std::swap(lhs_tail, rhs_tail);
+    if (lhs_tail == &rhs_head) {
+        lhs_tail = &lhs_head;
+    }
+    if (rhs_tail == &lhs_head) {
+        rhs_tail = &rhs_head;
+    }
+}
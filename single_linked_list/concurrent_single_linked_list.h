@@ -0,0 +1,169 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// Односвязный список в роли стека, общего для многих потоков: PushFront, PopFront и TryPopFront
+// не берут блокировок и выполняются через CAS на вершине (стек Трайбера).
+//
+// Проблема ABA решается счётчиком версий: вершина хранится парой {указатель, 64-битный счётчик}
+// и меняется двойной CAS (16 байт). Счётчик растёт при каждом изменении вершины, поэтому CAS
+// с устаревшей вершиной не пройдёт, даже если по тому же адресу снова оказался тот же узел;
+// переполнение 64-битного счётчика на практике недостижимо. Указатель хранится целиком, без
+// предположений о числе значащих бит адреса.
+// Извлечённые узлы не освобождаются, а уходят в собственный lock-free пул и используются повторно:
+// поток, который ещё читает next_node у извлечённого другим потоком узла, читает живую память.
+// Память узлов возвращается системе только в деструкторе.
+//
+// Неблокирующими операции остаются, пока в пуле есть свободные узлы; иначе узел выделяется через new.
+// GCC выполняет 16-байтные атомарные операции через libatomic (сборка с -latomic): на x86-64
+// с CMPXCHG16B она использует эту инструкцию без блокировок, хотя is_lock_free() возвращает false.
+// На платформах без двойной CAS libatomic защищает вершину блокировкой, и стек остаётся корректным,
+// но перестаёт быть lock-free
+template <typename Type>
+class ConcurrentSingleLinkedList {
+
+    struct Node {
+        Node() = default;
+
+        Type* Value() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+
+        std::atomic<Node*> next_node{nullptr};
+        alignas(Type) unsigned char storage[sizeof(Type)];
+    };
+
+    // Указатель на вершину стека вместе со счётчиком версий
+    struct TaggedPtr {
+        Node* node = nullptr;
+        std::uint64_t tag = 0;
+    };
+
+    static_assert(sizeof(TaggedPtr) == sizeof(Node*) + sizeof(std::uint64_t), "TaggedPtr must have no padding");
+
+public:
+
+    using value_type = Type;
+
+    ConcurrentSingleLinkedList() = default;
+
+    ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList&) = delete;
+    ConcurrentSingleLinkedList& operator=(const ConcurrentSingleLinkedList&) = delete;
+
+    // Вызывается, когда другие потоки уже не обращаются к списку
+    ~ConcurrentSingleLinkedList() {
+        while (Node* node = Pop(head_)) {
+            node->Value()->~Type();
+            delete node;
+        }
+        while (Node* node = Pop(free_)) {
+            delete node;
+        }
+    }
+
+    void PushFront(const Type& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    template <typename... Args>
+    void EmplaceFront(Args&&... args) {
+        Node* node = AcquireNode();
+        try {
+            new (node->storage) Type(std::forward<Args>(args)...);
+        } catch (...) {
+            Push(free_, node);
+            throw;
+        }
+        // Счётчик растёт до публикации узла, поэтому никогда не становится меньше нуля
+        size_.fetch_add(1, std::memory_order_relaxed);
+        Push(head_, node);
+    }
+
+    // Извлекает первый элемент в value. Возвращает false, если список был пуст
+    bool TryPopFront(Type& value) {
+        Node* node = Pop(head_);
+        if (node == nullptr) {
+            return false;
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        Type* stored = node->Value();
+        try {
+            value = std::move(*stored);
+        } catch (...) {
+            // Элемент не удалось отдать: возвращаем его в список
+            size_.fetch_add(1, std::memory_order_relaxed);
+            Push(head_, node);
+            throw;
+        }
+        stored->~Type();
+        Push(free_, node);
+        return true;
+    }
+
+    // Удаляет первый элемент, если он есть
+    void PopFront() noexcept {
+        if (Node* node = Pop(head_)) {
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            node->Value()->~Type();
+            Push(free_, node);
+        }
+    }
+
+    // Приблизительный размер: между изменением вершины и счётчика другие потоки
+    // могут увидеть значение, на единицу большее действительного
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return head_.load(std::memory_order_acquire).node == nullptr;
+    }
+
+    // Выполняется ли двойная CAS на вершине без блокировок (см. комментарий к классу)
+    [[nodiscard]] bool IsLockFree() const noexcept {
+        return head_.is_lock_free();
+    }
+
+private:
+    Node* AcquireNode() {
+        if (Node* node = Pop(free_)) {
+            return node;
+        }
+        return new Node();
+    }
+
+    static void Push(std::atomic<TaggedPtr>& top, Node* node) noexcept {
+        TaggedPtr old_top = top.load(std::memory_order_relaxed);
+        TaggedPtr new_top;
+        do {
+            node->next_node.store(old_top.node, std::memory_order_relaxed);
+            new_top = TaggedPtr{node, old_top.tag + 1};
+        } while (!top.compare_exchange_weak(old_top, new_top, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    static Node* Pop(std::atomic<TaggedPtr>& top) noexcept {
+        TaggedPtr old_top = top.load(std::memory_order_acquire);
+        while (Node* node = old_top.node) {
+            // Узел мог быть уже извлечён и переиспользован другим потоком: тогда next устарел,
+            // но счётчик вершины тоже изменился и CAS не пройдёт
+            Node* next = node->next_node.load(std::memory_order_relaxed);
+            if (top.compare_exchange_weak(old_top, TaggedPtr{next, old_top.tag + 1},
+                                          std::memory_order_acquire, std::memory_order_acquire)) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    // Вершина списка и вершина пула свободных узлов, каждая на своей кэш-линии
+    alignas(64) std::atomic<TaggedPtr> head_{TaggedPtr{}};
+    alignas(64) std::atomic<TaggedPtr> free_{TaggedPtr{}};
+    alignas(64) std::atomic<size_t> size_{0};
+};
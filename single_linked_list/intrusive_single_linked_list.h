@@ -0,0 +1,230 @@
+#pragma once
+#include "chain_iterator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Крючок, который встраивается в элемент интрузивного списка. Элемент с несколькими крючками
+// может одновременно состоять в нескольких списках, по одному на каждый крючок.
+// Копирование элемента не копирует связи: копия ни в каком списке не состоит
+struct IntrusiveListHook {
+    IntrusiveListHook() = default;
+
+    IntrusiveListHook(const IntrusiveListHook&) noexcept {
+    }
+
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept {
+        return *this;
+    }
+
+    IntrusiveListHook* next_node = nullptr;
+};
+
+// Интрузивный односвязный список: хранит не копии, а сами объекты пользователя, связывая их
+// через крючок Hook внутри Type, и поэтому ничего не выделяет. Интерфейс повторяет SingleLinkedList.
+// Список не владеет элементами: EraseAfter, PopFront и Clear только исключают их из списка,
+// а объект должен жить, пока состоит в списке
+template <typename Type, IntrusiveListHook Type::*Hook>
+class IntrusiveSingleLinkedList {
+
+    // Смещение крючка внутри Type, чтобы по крючку найти содержащий его объект
+    static std::ptrdiff_t HookOffset() noexcept {
+        std::aligned_storage_t<sizeof(Type), alignof(Type)> storage;
+        const Type* object = reinterpret_cast<const Type*>(&storage);
+        return reinterpret_cast<const char*>(&(object->*Hook)) - reinterpret_cast<const char*>(object);
+    }
+
+    template <typename, typename, typename>
+    friend class ChainIterator;
+
+    // Объект по его крючку; нужно итераторам (см. ChainIterator)
+    static Type* ValueOf(IntrusiveListHook* hook) noexcept {
+        return reinterpret_cast<Type*>(reinterpret_cast<char*>(hook) - HookOffset());
+    }
+
+    static IntrusiveListHook* HookOf(Type& value) noexcept {
+        return &(value.*Hook);
+    }
+
+public:
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using Iterator = ChainIterator<IntrusiveSingleLinkedList, IntrusiveListHook, Type>;
+    using ConstIterator = ChainIterator<IntrusiveSingleLinkedList, IntrusiveListHook, const Type>;
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_node};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{nullptr};
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_node};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr};
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<IntrusiveListHook*>(&head_)};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    // Итератор на элемент, который уже состоит в этом списке, за O(1)
+    [[nodiscard]] Iterator IteratorTo(Type& value) noexcept {
+        return Iterator{HookOf(value)};
+    }
+
+    IntrusiveSingleLinkedList() = default;
+
+    IntrusiveSingleLinkedList(const IntrusiveSingleLinkedList&) = delete;
+    IntrusiveSingleLinkedList& operator=(const IntrusiveSingleLinkedList&) = delete;
+
+    IntrusiveSingleLinkedList(IntrusiveSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    IntrusiveSingleLinkedList& operator=(IntrusiveSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    ~IntrusiveSingleLinkedList() {
+        Clear();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    void PushFront(Type& value) noexcept {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    // Вставляет элемент в конец списка за O(1)
+    void PushBack(Type& value) noexcept {
+        InsertAfter(ConstIterator{tail_}, value);
+    }
+
+    [[nodiscard]] Type& Front() noexcept {
+        assert(size_ != 0);
+        return *ValueOf(head_.next_node);
+    }
+
+    [[nodiscard]] const Type& Front() const noexcept {
+        assert(size_ != 0);
+        return *ValueOf(head_.next_node);
+    }
+
+    [[nodiscard]] Type& Back() noexcept {
+        assert(size_ != 0);
+        return *ValueOf(tail_);
+    }
+
+    [[nodiscard]] const Type& Back() const noexcept {
+        assert(size_ != 0);
+        return *ValueOf(tail_);
+    }
+
+    // Связывает value после pos. value не должен состоять в другом списке по тому же крючку
+    Iterator InsertAfter(ConstIterator pos, Type& value) noexcept {
+        assert(pos.node_ != nullptr);
+        IntrusiveListHook* node = HookOf(value);
+        node->next_node = pos.node_->next_node;
+        pos.node_->next_node = node;
+        if (pos.node_ == tail_) {
+            tail_ = node;
+        }
+        ++size_;
+        return Iterator{node};
+    }
+
+    void PopFront() noexcept {
+        if (head_.next_node != nullptr) {
+            EraseAfter(cbefore_begin());
+        }
+    }
+
+    // Исключает из списка элемент после pos, сам объект не разрушается
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ != nullptr);
+        IntrusiveListHook* to_unlink = pos.node_->next_node;
+        if (to_unlink == nullptr) {
+            return Iterator{nullptr};
+        }
+        pos.node_->next_node = to_unlink->next_node;
+        to_unlink->next_node = nullptr;
+        if (to_unlink == tail_) {
+            tail_ = pos.node_;
+        }
+        --size_;
+        return Iterator{pos.node_->next_node};
+    }
+
+    // Исключает из списка все элементы; крючки элементов сбрасываются
+    void Clear() noexcept {
+        while (head_.next_node != nullptr) {
+            IntrusiveListHook* node = head_.next_node;
+            head_.next_node = node->next_node;
+            node->next_node = nullptr;
+        }
+        tail_ = &head_;
+        size_ = 0;
+    }
+
+    void swap(IntrusiveSingleLinkedList& other) noexcept {
+        SwapChains(head_, tail_, other.head_, other.tail_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    IntrusiveListHook head_;
+    // Крючок последнего элемента или &head_, если список пуст
+    IntrusiveListHook* tail_ = &head_;
+    size_t size_ = 0;
+};
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+void swap(IntrusiveSingleLinkedList<Type, Hook>& lhs, IntrusiveSingleLinkedList<Type, Hook>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator==(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator!=(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return !(lhs == rhs);
+}
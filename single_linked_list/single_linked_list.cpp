@@ -1,106 +1,74 @@
+#include "chain_iterator.h" 
+ 
 #include <algorithm> 
 #include <cassert> 
 #include <cstddef> 
+#include <functional> 
 #include <initializer_list> 
 #include <iterator> 
+#include <memory> 
 #include <string> 
+#include <type_traits> 
 #include <utility> 
+#include <vector> 
+ 
+// Умеет ли аллокатор узлов освободить всю свою память разом (см. SlabAllocator::ReleaseAll) 
+template <typename Alloc, typename = void> 
+struct AllocatorCanReleaseAll : std::false_type { 
+}; 
  
-template <typename Type> 
+template <typename Alloc> 
+struct AllocatorCanReleaseAll<Alloc, std::void_t<decltype(std::declval<Alloc&>().ReleaseAll(size_t{}))>> 
+    : std::true_type { 
+}; 
+ 
+template <typename Type, typename Allocator = std::allocator<Type>> 
 class SingleLinkedList { 
      
-    struct Node { 
-        Node() = default; 
-        Node(const Type& val, Node* next) 
-            : value(val) 
-            , next_node(next) { 
-        } 
-        Type value; 
+    struct Node; 
+ 
+    // Заголовок узла без значения. head_ состоит только из заголовка, 
+    // поэтому Type не обязан иметь конструктор по умолчанию 
+    struct NodeBase { 
         Node* next_node = nullptr; 
     }; 
-     
-    template <typename ValueType> 
-    class BasicIterator { 
-         
-        friend class SingleLinkedList; 
-         
-        explicit BasicIterator(Node* node) : node_(node) { 
-        } 
-         
-    public: 
-         
-        using iterator_category = std::forward_iterator_tag; 
-        using value_type = Type; 
-        using difference_type = std::ptrdiff_t; 
-        using pointer = ValueType*; 
-        using reference = ValueType&; 
- 
-        BasicIterator() = default; 
  
-        BasicIterator(const BasicIterator<Type>& other) noexcept { 
-                    node_ = other.node_; 
-        } 
-         
-        BasicIterator& operator=(const BasicIterator& rhs) = default; 
- 
-        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept { 
-            return node_ == rhs.node_; 
-        } 
- 
-        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept { 
-            return node_ != rhs.node_; 
-        } 
- 
-        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept { 
-            return node_ == rhs.node_; 
-        } 
- 
-        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept { 
-            return node_ != rhs.node_; 
-        } 
- 
-        BasicIterator& operator++() noexcept { 
-            assert(node_ != nullptr); 
-            Node* next = node_->next_node; 
-            node_ = next; 
-            return *this; 
-        } 
- 
-        BasicIterator operator++(int) noexcept { 
-            auto old_value(*this); 
-            ++(*this); 
-            return old_value; 
-        } 
- 
-        [[nodiscard]] reference operator*() const noexcept { 
-            assert(node_ != nullptr); 
-            return node_->value; 
+    struct Node : NodeBase { 
+        // Значение строится прямо в узле из переданных аргументов 
+        template <typename... Args> 
+        explicit Node(Node* next, Args&&... args) 
+            : NodeBase{next} 
+            , value(std::forward<Args>(args)...) { 
         } 
+        Type value; 
+    }; 
  
-        [[nodiscard]] pointer operator->() const noexcept { 
-            assert(node_ != nullptr); 
-            return &(node_->value); 
-        } 
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; 
+    using NodeTraits = std::allocator_traits<NodeAllocator>; 
+     
+    template <typename, typename, typename> 
+    friend class ChainIterator; 
  
-    private: 
-        Node* node_ = nullptr; 
-    }; 
+    // Значение узла по его заголовку; нужно итераторам (см. ChainIterator) 
+    static Type* ValueOf(NodeBase* node) noexcept { 
+        return &static_cast<Node*>(node)->value; 
+    } 
      
 public: 
      
     using value_type = Type; 
+    using allocator_type = Allocator; 
     using reference = value_type&; 
     using const_reference = const value_type&; 
-    using Iterator = BasicIterator<Type>; 
-    using ConstIterator = BasicIterator<const Type>; 
+    using Iterator = ChainIterator<SingleLinkedList, NodeBase, Type>; 
+    using ConstIterator = ChainIterator<SingleLinkedList, NodeBase, const Type>; 
      
     [[nodiscard]] Iterator begin() noexcept { 
         return Iterator{head_.next_node}; 
     } 
  
     [[nodiscard]] Iterator end() noexcept { 
-        Node* last = LastNode(); 
-        return Iterator{last}; 
+        return Iterator{nullptr}; 
     } 
  
     [[nodiscard]] ConstIterator cbegin() const noexcept { 
@@ -112,17 +80,7 @@ public:
     } 
  
     [[nodiscard]] ConstIterator cend() const noexcept { 
-        Node* last = LastNode(); 
-        return ConstIterator{last}; 
-    } 
- 
-    Node* LastNode() const { 
-        Node* first = head_.next_node; 
-        while(first != nullptr){ 
-            Node* second = first->next_node; 
-            first = second; 
-        } 
-        return first; 
+        return ConstIterator{nullptr}; 
     } 
      
     [[nodiscard]] ConstIterator end() const noexcept { 
@@ -130,6 +88,10 @@ public:
     } 
      
     SingleLinkedList(){} 
+ 
+    explicit SingleLinkedList(const Allocator& alloc) 
+        : node_alloc_(alloc) { 
+        } 
      
     ~SingleLinkedList() { 
         Clear(); 
@@ -143,47 +105,109 @@ public:
         return size_ == 0; 
     } 
  
+    [[nodiscard]] Allocator GetAllocator() const { 
+        return Allocator(node_alloc_); 
+    } 
+ 
     void PushFront(const Type& value) { 
-        head_.next_node = new Node(value, head_.next_node); 
+        EmplaceFront(value); 
+    } 
+ 
+    void PushFront(Type&& value) { 
+        EmplaceFront(std::move(value)); 
+    } 
+ 
+    // Создаёт элемент в начале списка из аргументов конструктора Type 
+    template <typename... Args> 
+    Type& EmplaceFront(Args&&... args) { 
+        head_.next_node = CreateNode(head_.next_node, std::forward<Args>(args)...); 
+        if (tail_ == &head_) { 
+            tail_ = head_.next_node; 
+        } 
         ++size_; 
+        return head_.next_node->value; 
+    } 
+ 
+    // Вставляет элемент в конец списка за O(1) 
+    void PushBack(const Type& value) { 
+        EmplaceBack(value); 
+    } 
+ 
+    void PushBack(Type&& value) { 
+        EmplaceBack(std::move(value)); 
+    } 
+ 
+    template <typename... Args> 
+    Type& EmplaceBack(Args&&... args) { 
+        Node* node = CreateNode(nullptr, std::forward<Args>(args)...); 
+        tail_->next_node = node; 
+        tail_ = node; 
+        ++size_; 
+        return node->value; 
+    } 
+ 
+    [[nodiscard]] Type& Back() noexcept { 
+        assert(size_ != 0); 
+        return static_cast<Node*>(tail_)->value; 
+    } 
+ 
+    [[nodiscard]] const Type& Back() const noexcept { 
+        assert(size_ != 0); 
+        return static_cast<const Node*>(tail_)->value; 
     } 
      
     void Clear() noexcept { 
-         
+        // Узлы с тривиально разрушаемыми значениями можно не обходить: если все блоки 
+        // аллокатора принадлежат этому списку, он освобождает их целиком 
+        if constexpr (std::is_trivially_destructible_v<Type> && AllocatorCanReleaseAll<NodeAllocator>::value) { 
+            if (node_alloc_.ReleaseAll(size_)) { 
+                head_.next_node = nullptr; 
+                tail_ = &head_; 
+                size_ = 0; 
+                return; 
+            } 
+        } 
+ 
         while (head_.next_node != nullptr) { 
             Node* tmp = head_.next_node; 
             head_.next_node = tmp->next_node; 
-            delete tmp; 
+            DestroyNode(tmp); 
         } 
+        tail_ = &head_; 
         size_ = 0; 
     } 
      
+    // Элементы копируются или, если переданы std::move_iterator, перемещаются из [first, last). 
+    // Диапазон проходится один раз, поэтому подходят и однопроходные итераторы 
     template <typename InputIt> 
-    SingleLinkedList(InputIt first, InputIt last) { 
+    SingleLinkedList(InputIt first, InputIt last, const Allocator& alloc = Allocator()) 
+        : node_alloc_(alloc) { 
         assert(size_ == 0 && head_.next_node == nullptr); 
  
-        SingleLinkedList tmp; 
-        Node* current = &tmp.head_; 
- 
+        SingleLinkedList tmp(alloc); 
         for (InputIt it = first; it != last; ++it) { 
-            Node* new_node = new Node(*it, nullptr); 
-            current->next_node = new_node; 
-            current = new_node; 
+            tmp.EmplaceBack(*it); 
         } 
-         
-        tmp.size_ = std::distance(first, last); 
         swap(tmp); 
     } 
      
-    SingleLinkedList(std::initializer_list<Type> values) 
-        : SingleLinkedList(values.begin(), values.end()) { 
+    SingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator()) 
+        : SingleLinkedList(values.begin(), values.end(), alloc) { 
         } 
  
     // Конструктор копирования 
     SingleLinkedList(const SingleLinkedList& other) 
-        : SingleLinkedList(other.begin(), other.end()) { 
+        : SingleLinkedList(other.begin(), other.end(), 
+                           Allocator(NodeTraits::select_on_container_copy_construction(other.node_alloc_))) { 
         } 
      
+    // Конструктор перемещения забирает узлы other, не выделяя памяти. 
+    // other остаётся пустым и сохраняет копию аллокатора, так что им можно пользоваться дальше 
+    SingleLinkedList(SingleLinkedList&& other) noexcept 
+        : node_alloc_(other.node_alloc_) { 
+        TakeNodes(other); 
+    } 
+ 
     SingleLinkedList& operator=(const SingleLinkedList& rhs) { 
         if (this != &rhs){ 
             auto tmp(rhs); 
@@ -192,8 +216,36 @@ public:
         return *this; 
     } 
  
+    // Узлы забираются целиком, если аллокатор переходит вместе с ними или аллокаторы равны. 
+    // Иначе элементы перемещаются по одному в узлы из собственного аллокатора 
+    SingleLinkedList& operator=(SingleLinkedList&& rhs) noexcept( 
+        NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) { 
+        if (this == &rhs) { 
+            return *this; 
+        } 
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) { 
+            Clear(); 
+            node_alloc_ = rhs.node_alloc_; 
+            TakeNodes(rhs); 
+        } else { 
+            if (node_alloc_ == rhs.node_alloc_) { 
+                Clear(); 
+                TakeNodes(rhs); 
+            } else { 
+                SingleLinkedList tmp(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()), 
+                                     GetAllocator()); 
+                swap(tmp); 
+                rhs.Clear(); 
+            } 
+        } 
+        return *this; 
+    } 
+ 
+    // Списки обмениваются и узлами, и аллокаторами 
     void swap(SingleLinkedList& other) noexcept { 
-        std::swap(head_.next_node, other.head_.next_node); 
+        using std::swap; 
+        swap(node_alloc_, other.node_alloc_); 
+        SwapChains(head_, tail_, other.head_, other.tail_); 
         std::swap(size_, other.size_); 
     } 
  
@@ -202,17 +254,30 @@ public:
     } 
  
     [[nodiscard]] ConstIterator cbefore_begin() const noexcept { 
-        return ConstIterator{const_cast<Node*>(&head_)}; 
+        return ConstIterator{const_cast<NodeBase*>(&head_)}; 
     } 
  
     [[nodiscard]] ConstIterator before_begin() const noexcept { 
-        return ConstIterator(&head_); 
+        return cbefore_begin(); 
     } 
      
     Iterator InsertAfter(ConstIterator pos, const Type& value) { 
+        return EmplaceAfter(pos, value); 
+    } 
+ 
+    Iterator InsertAfter(ConstIterator pos, Type&& value) { 
+        return EmplaceAfter(pos, std::move(value)); 
+    } 
+ 
+    // Создаёт элемент после pos из аргументов конструктора Type 
+    template <typename... Args> 
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) { 
         assert(pos.node_ != nullptr); 
-        Node* new_node = new Node(value, pos.node_->next_node); 
+        Node* new_node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...); 
         pos.node_->next_node = new_node; 
+        if (pos.node_ == tail_) { 
+            tail_ = new_node; 
+        } 
         ++size_; 
         return Iterator(new_node); 
     } 
@@ -221,7 +286,10 @@ public:
         if (head_.next_node != nullptr) { 
             Node* to_delete = head_.next_node; 
             head_.next_node = head_.next_node->next_node; 
-            delete to_delete; 
+            if (to_delete == tail_) { 
+                tail_ = &head_; 
+            } 
+            DestroyNode(to_delete); 
             --size_; 
         } 
     } 
@@ -232,49 +300,498 @@ public:
         if (pos.node_->next_node != nullptr) { 
             Node* to_delete = pos.node_->next_node; 
             pos.node_->next_node = to_delete->next_node; 
-            delete to_delete; 
+            if (to_delete == tail_) { 
+                tail_ = pos.node_; 
+            } 
+            DestroyNode(to_delete); 
             --size_; 
             return Iterator(pos.node_->next_node); 
         } 
         return Iterator(nullptr); 
     } 
-     
+ 
+    // Операции ниже переставляют узлы, не выделяя и не копируя их. 
+    // Узлы можно переносить только между списками с равными аллокаторами 
+ 
+    // Переносит все элементы other в позицию после pos 
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept { 
+        assert(pos.node_ != nullptr && node_alloc_ == other.node_alloc_); 
+        if (&other == this || other.IsEmpty()) { 
+            return; 
+        } 
+        Node* first = other.head_.next_node; 
+        Node* last = static_cast<Node*>(other.tail_); 
+        size_t count = other.size_; 
+        other.head_.next_node = nullptr; 
+        other.tail_ = &other.head_; 
+        other.size_ = 0; 
+        LinkAfter(pos.node_, first, last, count); 
+    } 
+ 
+    void SpliceAfter(ConstIterator pos, SingleLinkedList&& other) noexcept { 
+        SpliceAfter(pos, other); 
+    } 
+ 
+    // Переносит элемент, следующий за it, из other в позицию после pos 
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator it) noexcept { 
+        assert(pos.node_ != nullptr && it.node_ != nullptr && node_alloc_ == other.node_alloc_); 
+        Node* node = it.node_->next_node; 
+        if (node == nullptr || pos.node_ == it.node_ || pos.node_ == node) { 
+            return; 
+        } 
+        other.UnlinkAfter(it.node_, node, 1); 
+        LinkAfter(pos.node_, node, node, 1); 
+    } 
+ 
+    void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator it) noexcept { 
+        SpliceAfter(pos, other, it); 
+    } 
+ 
+    // Переносит элементы из интервала (first, last) списка other в позицию после pos. 
+    // Длину интервала приходится считать, поэтому операция линейна по числу переносимых узлов 
+    void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last) noexcept { 
+        assert(pos.node_ != nullptr && first.node_ != nullptr && node_alloc_ == other.node_alloc_); 
+        if (first.node_->next_node == last.node_) { 
+            return; 
+        } 
+        Node* moved_first = first.node_->next_node; 
+        Node* moved_last = moved_first; 
+        size_t count = 1; 
+        while (moved_last->next_node != last.node_) { 
+            moved_last = moved_last->next_node; 
+            ++count; 
+        } 
+        other.UnlinkAfter(first.node_, moved_last, count); 
+        LinkAfter(pos.node_, moved_first, moved_last, count); 
+    } 
+ 
+    void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator first, ConstIterator last) noexcept { 
+        SpliceAfter(pos, other, first, last); 
+    } 
+ 
+    // Сливает два отсортированных списка. Слияние устойчиво: при равенстве 
+    // элементы *this идут раньше элементов other. Если comp бросит исключение, все элементы 
+    // окажутся в *this, other станет пустым, но порядок элементов не определён 
+    template <typename Compare> 
+    void Merge(SingleLinkedList& other, Compare comp) { 
+        assert(node_alloc_ == other.node_alloc_); 
+        if (&other == this || other.IsEmpty()) { 
+            return; 
+        } 
+        Node* lhs = head_.next_node; 
+        Node* rhs = other.head_.next_node; 
+        NodeBase* rhs_tail = other.tail_; 
+        size_ += other.size_; 
+        other.head_.next_node = nullptr; 
+        other.tail_ = &other.head_; 
+        other.size_ = 0; 
+ 
+        NodeBase* last = &head_; 
+        try { 
+            while (lhs != nullptr && rhs != nullptr) { 
+                if (comp(rhs->value, lhs->value)) { 
+                    last->next_node = rhs; 
+                    rhs = rhs->next_node; 
+                } else { 
+                    last->next_node = lhs; 
+                    lhs = lhs->next_node; 
+                } 
+                last = last->next_node; 
+            } 
+        } catch (...) { 
+            // Обе цепочки ещё не пусты: остаток *this по-прежнему заканчивается в tail_, 
+            // остаток other дописывается за ним 
+            last->next_node = lhs; 
+            tail_->next_node = rhs; 
+            tail_ = rhs_tail; 
+            throw; 
+        } 
+        if (lhs != nullptr) { 
+            last->next_node = lhs; 
+        } else { 
+            last->next_node = rhs; 
+            tail_ = rhs_tail; 
+        } 
+    } 
+ 
+    void Merge(SingleLinkedList& other) { 
+        Merge(other, std::less<>()); 
+    } 
+ 
+    void Merge(SingleLinkedList&& other) { 
+        Merge(other, std::less<>()); 
+    } 
+ 
+    // Устойчивая сортировка слиянием снизу вверх за O(n log n) без выделения памяти: 
+    // bins[i] хранит уже отсортированную цепочку из 2^i узлов. Если comp бросит исключение, 
+    // список сохранит все элементы, но их порядок не определён 
+    template <typename Compare> 
+    void Sort(Compare comp) { 
+        if (size_ < 2) { 
+            return; 
+        } 
+        Node* bins[kSortBins] = {}; 
+        Node* unsorted = head_.next_node; 
+        Node* carry = nullptr; 
+        Node* result = nullptr; 
+        try { 
+            while (unsorted != nullptr) { 
+                carry = unsorted; 
+                unsorted = unsorted->next_node; 
+                carry->next_node = nullptr; 
+ 
+                size_t i = 0; 
+                for (; bins[i] != nullptr; ++i) { 
+                    // В bins[i] лежат более ранние элементы, поэтому он идёт первым аргументом 
+                    carry = MergeChains(bins[i], carry, comp); 
+                    bins[i] = nullptr; 
+                } 
+                bins[i] = carry; 
+                carry = nullptr; 
+            } 
+ 
+            for (Node*& bin : bins) { 
+                if (bin != nullptr) { 
+                    result = result == nullptr ? bin : MergeChains(bin, result, comp); 
+                    bin = nullptr; 
+                } 
+            } 
+        } catch (...) { 
+            // Каждый узел лежит ровно в одной из цепочек: собираем их обратно в список 
+            Node* chain = AppendChain(carry, AppendChain(result, unsorted)); 
+            for (Node* bin : bins) { 
+                chain = AppendChain(bin, chain); 
+            } 
+            head_.next_node = chain; 
+            ResetTail(); 
+            throw; 
+        } 
+ 
+        head_.next_node = result; 
+        ResetTail(); 
+    } 
+ 
+    void Sort() { 
+        Sort(std::less<>()); 
+    } 
+ 
+    void Reverse() noexcept { 
+        Node* reversed = nullptr; 
+        Node* current = head_.next_node; 
+        tail_ = current != nullptr ? current : &head_; 
+        while (current != nullptr) { 
+            Node* next = current->next_node; 
+            current->next_node = reversed; 
+            reversed = current; 
+            current = next; 
+        } 
+        head_.next_node = reversed; 
+    } 
+ 
+    // Удаляет подряд идущие элементы, равные предыдущему (по pred). Возвращает число удалённых 
+    template <typename BinaryPredicate> 
+    size_t Unique(BinaryPredicate pred) { 
+        size_t removed = 0; 
+        Node* current = head_.next_node; 
+        while (current != nullptr && current->next_node != nullptr) { 
+            if (pred(current->value, current->next_node->value)) { 
+                EraseAfter(ConstIterator{current}); 
+                ++removed; 
+            } else { 
+                current = current->next_node; 
+            } 
+        } 
+        return removed; 
+    } 
+ 
+    size_t Unique() { 
+        return Unique(std::equal_to<>()); 
+    } 
+ 
+    // Удаляет элементы, для которых pred возвращает true. Возвращает число удалённых 
+    template <typename UnaryPredicate> 
+    size_t RemoveIf(UnaryPredicate pred) { 
+        size_t removed = 0; 
+        NodeBase* prev = &head_; 
+        while (prev->next_node != nullptr) { 
+            if (pred(prev->next_node->value)) { 
+                EraseAfter(ConstIterator{prev}); 
+                ++removed; 
+            } else { 
+                prev = prev->next_node; 
+            } 
+        } 
+        return removed; 
+    } 
+ 
+    size_t Remove(const Type& value) { 
+        return RemoveIf([&value](const Type& item) { 
+            return item == value; 
+        }); 
+    } 
+ 
+    // Обходы ниже запрашивают следующий узел до обработки текущего (см. VisitNodes) 
+ 
+    template <typename Func> 
+    void ForEach(Func func) { 
+        VisitNodes(head_.next_node, size_, [&func](Node* node) { 
+            func(node->value); 
+            return false; 
+        }); 
+    } 
+ 
+    template <typename Func> 
+    void ForEach(Func func) const { 
+        VisitNodes(head_.next_node, size_, [&func](const Node* node) { 
+            func(node->value); 
+            return false; 
+        }); 
+    } 
+ 
+    template <typename T, typename BinaryOp = std::plus<>> 
+    [[nodiscard]] T Accumulate(T init, BinaryOp op = BinaryOp()) const { 
+        VisitNodes(head_.next_node, size_, [&init, &op](const Node* node) { 
+            init = op(std::move(init), node->value); 
+            return false; 
+        }); 
+        return init; 
+    } 
+ 
+    template <typename UnaryPredicate> 
+    [[nodiscard]] Iterator FindIf(UnaryPredicate pred) { 
+        Node* found = nullptr; 
+        VisitNodes(head_.next_node, size_, [&found, &pred](Node* node) { 
+            if (pred(node->value)) { 
+                found = node; 
+                return true; 
+            } 
+            return false; 
+        }); 
+        return Iterator{found}; 
+    } 
+ 
+    template <typename UnaryPredicate> 
+    [[nodiscard]] ConstIterator FindIf(UnaryPredicate pred) const { 
+        return const_cast<SingleLinkedList*>(this)->FindIf([&pred](const Type& value) { 
+            return pred(value); 
+        }); 
+    } 
+ 
+    // Параллельный обход: один проход только по указателям делит список на куски, 
+    // которые затем выполняются в потоках pool и в вызывающем потоке. pool — любой пул 
+    // с GetThreadCount() и RunBatch(count, task), например ThreadPool из thread_pool.h. 
+    // func вызывается одновременно из разных потоков для разных элементов. 
+    // Первое исключение из func пробрасывается после завершения всех кусков 
+    template <typename Pool, typename Func> 
+    void ParallelForEach(Pool& pool, Func func) { 
+        ForEachChunk(pool, [&func](Node* first, size_t count) { 
+            VisitNodes(first, count, [&func](Node* node) { 
+                func(node->value); 
+                return false; 
+            }); 
+        }); 
+    } 
+ 
+    // Заменяет каждый элемент на op(элемент), обрабатывая куски списка параллельно 
+    template <typename Pool, typename UnaryOp> 
+    void ParallelTransform(Pool& pool, UnaryOp op) { 
+        ParallelForEach(pool, [&op](Type& value) { 
+            value = op(std::as_const(value)); 
+        }); 
+    } 
+ 
 private: 
-    Node head_; 
+    // Хватает на списки из 2^64 - 1 элементов 
+    static constexpr size_t kSortBins = 64; 
+    // Более короткие куски не окупают передачу задачи в пул 
+    static constexpr size_t kMinParallelChunk = 4 * 1024; 
+ 
+    static void Prefetch([[maybe_unused]] const void* address) noexcept { 
+#if defined(__GNUC__) || defined(__clang__) 
+        __builtin_prefetch(address); 
+#endif 
+    } 
+ 
+    // Передаёт visit не более count узлов, начиная с node, пока visit не вернёт true. 
+    // Адрес следующего узла известен до вызова visit, и его загрузка запрашивается заранее. 
+    // Дальше чем на узел вперёд заглянуть нельзя: адрес узла через один хранится в ещё 
+    // не загруженном следующем. Поэтому загрузки идут цепочкой, а выигрыш есть, только если 
+    // visit выполняет над элементом заметную работу, с которой загрузка успевает совместиться 
+    template <typename NodeType, typename Visit> 
+    static void VisitNodes(NodeType* node, size_t count, Visit&& visit) { 
+        for (size_t i = 0; i < count && node != nullptr; ++i) { 
+            NodeType* next = node->next_node; 
+            Prefetch(next); 
+            if (visit(node)) { 
+                return; 
+            } 
+            node = next; 
+        } 
+    } 
+ 
+    // Делит список на куски примерно равной длины и вызывает run(first, count) для каждого 
+    // в потоках pool и в текущем потоке 
+    template <typename Pool, typename ChunkFunc> 
+    void ForEachChunk(Pool& pool, ChunkFunc&& run) { 
+        const size_t chunks = std::max<size_t>(1, std::min(pool.GetThreadCount() + 1, size_ / kMinParallelChunk)); 
+        if (chunks == 1) { 
+            run(head_.next_node, size_); 
+            return; 
+        } 
+ 
+        const size_t chunk_size = size_ / chunks; 
+        std::vector<Node*> starts; 
+        starts.reserve(chunks); 
+        Node* node = head_.next_node; 
+        for (size_t i = 0; i < chunks; ++i) { 
+            starts.push_back(node); 
+            for (size_t j = 0; j < chunk_size && i + 1 < chunks; ++j) { 
+                node = node->next_node; 
+            } 
+        } 
+ 
+        pool.RunBatch(chunks, [&](size_t i) { 
+            // Последний кусок забирает остаток от деления 
+            run(starts[i], i + 1 < chunks ? chunk_size : size_ - chunk_size * (chunks - 1)); 
+        }); 
+    } 
+ 
+    // Сливает две отсортированные цепочки узлов; при равенстве первым идёт узел из lhs. 
+    // Если comp бросит исключение, все узлы обеих цепочек остаются в lhs, а rhs становится пустой 
+    template <typename Compare> 
+    static Node* MergeChains(Node*& lhs, Node*& rhs, Compare& comp) { 
+        Node* result = nullptr; 
+        Node** link = &result; 
+        try { 
+            while (lhs != nullptr && rhs != nullptr) { 
+                if (comp(rhs->value, lhs->value)) { 
+                    *link = rhs; 
+                    rhs = rhs->next_node; 
+                } else { 
+                    *link = lhs; 
+                    lhs = lhs->next_node; 
+                } 
+                link = &(*link)->next_node; 
+            } 
+        } catch (...) { 
+            *link = lhs; 
+            lhs = AppendChain(result, rhs); 
+            rhs = nullptr; 
+            throw; 
+        } 
+        *link = lhs != nullptr ? lhs : rhs; 
+        return result; 
+    } 
+ 
+    // Дописывает цепочку rhs в конец цепочки lhs и возвращает начало общей цепочки 
+    static Node* AppendChain(Node* lhs, Node* rhs) noexcept { 
+        if (lhs == nullptr) { 
+            return rhs; 
+        } 
+        Node* last = lhs; 
+        while (last->next_node != nullptr) { 
+            last = last->next_node; 
+        } 
+        last->next_node = rhs; 
+        return lhs; 
+    } 
+ 
+    // Находит последний узел заново после перестановки узлов 
+    void ResetTail() noexcept { 
+        tail_ = &head_; 
+        while (tail_->next_node != nullptr) { 
+            tail_ = tail_->next_node; 
+        } 
+    } 
+ 
+    // Вставляет цепочку first..last из count узлов после pos 
+    void LinkAfter(NodeBase* pos, Node* first, Node* last, size_t count) noexcept { 
+        last->next_node = pos->next_node; 
+        pos->next_node = first; 
+        if (pos == tail_) { 
+            tail_ = last; 
+        } 
+        size_ += count; 
+    } 
+ 
+    // Отцепляет цепочку из count узлов, идущую после pos и заканчивающуюся last 
+    void UnlinkAfter(NodeBase* pos, Node* last, size_t count) noexcept { 
+        pos->next_node = last->next_node; 
+        if (last == tail_) { 
+            tail_ = pos; 
+        } 
+        size_ -= count; 
+    } 
+ 
+    // Забирает все узлы other; *this должен быть пуст 
+    void TakeNodes(SingleLinkedList& other) noexcept { 
+        assert(IsEmpty()); 
+        if (other.IsEmpty()) { 
+            return; 
+        } 
+        head_.next_node = other.head_.next_node; 
+        tail_ = other.tail_; 
+        size_ = other.size_; 
+        other.head_.next_node = nullptr; 
+        other.tail_ = &other.head_; 
+        other.size_ = 0; 
+    } 
+ 
+    template <typename... Args> 
+    Node* CreateNode(Node* next, Args&&... args) { 
+        Node* node = NodeTraits::allocate(node_alloc_, 1); 
+        try { 
+            NodeTraits::construct(node_alloc_, node, next, std::forward<Args>(args)...); 
+        } catch (...) { 
+            NodeTraits::deallocate(node_alloc_, node, 1); 
+            throw; 
+        } 
+        return node; 
+    } 
+ 
+    void DestroyNode(Node* node) noexcept { 
+        NodeTraits::destroy(node_alloc_, node); 
+        NodeTraits::deallocate(node_alloc_, node, 1); 
+    } 
+ 
+    NodeAllocator node_alloc_; 
+    NodeBase head_; 
+    // Последний узел списка или &head_, если список пуст 
+    NodeBase* tail_ = &head_; 
     size_t size_ = 0; 
 }; 
  
-template <typename Type> 
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept { 
+template <typename Type, typename Allocator> 
+void swap(SingleLinkedList<Type, Allocator>& lhs, SingleLinkedList<Type, Allocator>& rhs) noexcept { 
     lhs.swap(rhs); 
 } 
  
-template <typename Type> 
-bool operator==(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { 
+template <typename Type, typename Allocator> 
+bool operator==(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) { 
     return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin()); 
 } 
  
-template <typename Type> 
-bool operator!=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { 
+template <typename Type, typename Allocator> 
+bool operator!=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) { 
     return !(lhs == rhs); 
 } 
  
-template <typename Type> 
-bool operator<(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { 
+template <typename Type, typename Allocator> 
+bool operator<(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) { 
     return std::lexicographical_compare(lhs.cbegin(),lhs.cend(),rhs.cbegin(), rhs.cend()); 
 } 
  
-template <typename Type> 
-bool operator<=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { 
+template <typename Type, typename Allocator> 
+bool operator<=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) { 
     return !(rhs < lhs); 
 } 
  
-template <typename Type> 
-bool operator>(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { 
+template <typename Type, typename Allocator> 
+bool operator>(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) { 
     return rhs < lhs; 
 } 
  
-template <typename Type> 
-bool operator>=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { 
+template <typename Type, typename Allocator> 
+bool operator>=(const SingleLinkedList<Type, Allocator>& lhs, const SingleLinkedList<Type, Allocator>& rhs) { 
     return !(lhs < rhs); 
 } 
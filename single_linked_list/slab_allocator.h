@@ -0,0 +1,391 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+// Пул блоков одного размера. Память запрашивается у системы слэбами (непрерывными кусками
+// на много блоков), освобождённые блоки попадают в список свободных и выдаются повторно.
+// Размер блока фиксируется при первом выделении, более крупные запросы пул не обслуживает
+class SlabPool {
+public:
+    // Узел списка свободных блоков, размещается прямо в освобождённом блоке
+    struct FreeChunk {
+        FreeChunk* next = nullptr;
+    };
+
+    explicit SlabPool(bool thread_safe = false) : thread_safe_(thread_safe) {
+    }
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    ~SlabPool() {
+        ReleaseSlabs();
+    }
+
+    [[nodiscard]] std::uint64_t GetId() const noexcept {
+        return id_;
+    }
+
+    // Может ли пул выдавать блоки под объекты такого размера и выравнивания.
+    // Первый вызов фиксирует размер блока пула
+    [[nodiscard]] bool Fits(size_t size, size_t align) noexcept {
+        size_t chunk_size = chunk_size_.load(std::memory_order_acquire);
+        if (chunk_size == 0) {
+            auto guard = Lock();
+            chunk_size = chunk_size_.load(std::memory_order_relaxed);
+            if (chunk_size == 0) {
+                chunk_align_ = std::max(align, alignof(FreeChunk));
+                chunk_size = (std::max(size, sizeof(FreeChunk)) + chunk_align_ - 1) / chunk_align_ * chunk_align_;
+                chunk_size_.store(chunk_size, std::memory_order_release);
+            }
+        }
+        return size <= chunk_size && align <= chunk_align_;
+    }
+
+    // Обслуживает ли пул объекты такого размера. В отличие от Fits не фиксирует размер блока
+    [[nodiscard]] bool Serves(size_t size, size_t align) const noexcept {
+        const size_t chunk_size = chunk_size_.load(std::memory_order_acquire);
+        return chunk_size != 0 && size <= chunk_size && align <= chunk_align_;
+    }
+
+    void* Allocate() {
+        auto guard = Lock();
+        return AllocateUnlocked();
+    }
+
+    void Deallocate(void* chunk) noexcept {
+        auto guard = Lock();
+        DeallocateUnlocked(chunk);
+    }
+
+    // Выдаёт до count блоков одним списком, возвращает число выданных
+    size_t AllocateBatch(FreeChunk*& chunks, size_t count) {
+        auto guard = Lock();
+        size_t allocated = 0;
+        try {
+            for (; allocated < count; ++allocated) {
+                auto* chunk = static_cast<FreeChunk*>(AllocateUnlocked());
+                chunk->next = chunks;
+                chunks = chunk;
+            }
+        } catch (...) {
+            if (allocated == 0) {
+                throw;
+            }
+        }
+        return allocated;
+    }
+
+    void DeallocateBatch(FreeChunk* chunks) noexcept {
+        auto guard = Lock();
+        while (chunks != nullptr) {
+            FreeChunk* next = chunks->next;
+            DeallocateUnlocked(chunks);
+            chunks = next;
+        }
+    }
+
+    // Освобождает все слэбы разом, если снаружи живут ровно live_chunks блоков
+    // (то есть все они принадлежат вызывающему и больше не нужны)
+    bool ReleaseAll(size_t live_chunks) noexcept {
+        auto guard = Lock();
+        if (live_ != live_chunks) {
+            return false;
+        }
+        ReleaseSlabs();
+        return true;
+    }
+
+    [[nodiscard]] size_t GetLiveCount() const noexcept {
+        auto guard = Lock();
+        return live_;
+    }
+
+private:
+    // Слэб начинается с заголовка, за которым идут блоки
+    struct Slab {
+        Slab* next = nullptr;
+        size_t bytes = 0;
+    };
+
+    static constexpr size_t kFirstSlabChunks = 32;
+    static constexpr size_t kMaxSlabBytes = 64 * 1024;
+
+    [[nodiscard]] std::unique_lock<std::mutex> Lock() const {
+        return thread_safe_ ? std::unique_lock<std::mutex>(mutex_) : std::unique_lock<std::mutex>();
+    }
+
+    void* AllocateUnlocked() {
+        const size_t chunk_size = chunk_size_.load(std::memory_order_relaxed);
+        assert(chunk_size != 0);
+        ++live_;
+        if (free_list_ != nullptr) {
+            FreeChunk* chunk = free_list_;
+            free_list_ = chunk->next;
+            return chunk;
+        }
+        if (bump_ == bump_end_) {
+            try {
+                AddSlab();
+            } catch (...) {
+                --live_;
+                throw;
+            }
+        }
+        void* chunk = bump_;
+        bump_ += chunk_size;
+        return chunk;
+    }
+
+    void DeallocateUnlocked(void* chunk) noexcept {
+        assert(live_ != 0);
+        auto* free_chunk = static_cast<FreeChunk*>(chunk);
+        free_chunk->next = free_list_;
+        free_list_ = free_chunk;
+        --live_;
+    }
+
+    // Каждый следующий слэб вдвое больше предыдущего, но не больше kMaxSlabBytes
+    void AddSlab() {
+        const size_t chunk_size = chunk_size_.load(std::memory_order_relaxed);
+        const size_t header = (sizeof(Slab) + chunk_align_ - 1) / chunk_align_ * chunk_align_;
+        const size_t chunks = std::max<size_t>(1, std::min(next_slab_chunks_, kMaxSlabBytes / chunk_size));
+        const size_t bytes = header + chunks * chunk_size;
+
+        void* memory = ::operator new(bytes, std::align_val_t(chunk_align_));
+        auto* slab = new (memory) Slab{slabs_, bytes};
+        slabs_ = slab;
+
+        bump_ = static_cast<char*>(memory) + header;
+        bump_end_ = bump_ + chunks * chunk_size;
+        next_slab_chunks_ = chunks * 2;
+    }
+
+    void ReleaseSlabs() noexcept {
+        while (slabs_ != nullptr) {
+            Slab* next = slabs_->next;
+            ::operator delete(slabs_, slabs_->bytes, std::align_val_t(chunk_align_));
+            slabs_ = next;
+        }
+        free_list_ = nullptr;
+        bump_ = nullptr;
+        bump_end_ = nullptr;
+        live_ = 0;
+        next_slab_chunks_ = kFirstSlabChunks;
+    }
+
+    static std::uint64_t NextId() noexcept {
+        static std::atomic<std::uint64_t> last_id{0};
+        return last_id.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    const std::uint64_t id_ = NextId();
+    const bool thread_safe_;
+    mutable std::mutex mutex_;
+
+    // Размер блока задаётся один раз при первом вызове Fits и дальше читается без блокировки
+    std::atomic<size_t> chunk_size_{0};
+    size_t chunk_align_ = 0;
+    size_t next_slab_chunks_ = kFirstSlabChunks;
+
+    Slab* slabs_ = nullptr;
+    FreeChunk* free_list_ = nullptr;
+    // Ещё ни разу не выданная часть последнего слэба: блоки из неё идут подряд
+    char* bump_ = nullptr;
+    char* bump_end_ = nullptr;
+    // Блоки, выданные наружу (включая лежащие в кэшах потоков)
+    size_t live_ = 0;
+};
+
+// Аллокатор поверх SlabPool. Копии аллокатора (в том числе перепривязанные к другому типу)
+// разделяют один пул; копия контейнера получает собственный пул.
+// При ThreadSafe = true пул защищён мьютексом, а каждый поток держит небольшие кэши
+// свободных блоков нескольких пулов и обращается к пулу пачками, что снимает конкуренцию за мьютекс
+template <typename T, bool ThreadSafe = false>
+class SlabAllocator {
+    template <typename U, bool OtherThreadSafe>
+    friend class SlabAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind {
+        using other = SlabAllocator<U, ThreadSafe>;
+    };
+
+    SlabAllocator() : pool_(std::make_shared<SlabPool>(ThreadSafe)) {
+    }
+
+    // Перемещение аллокатора копирует его: исходный объект должен остаться рабочим
+    SlabAllocator(const SlabAllocator&) = default;
+    SlabAllocator& operator=(const SlabAllocator&) = default;
+
+    template <typename U>
+    SlabAllocator(const SlabAllocator<U, ThreadSafe>& other) noexcept : pool_(other.pool_) {
+    }
+
+    [[nodiscard]] SlabAllocator select_on_container_copy_construction() const {
+        return SlabAllocator();
+    }
+
+    [[nodiscard]] T* allocate(size_t n) {
+        if (n != 1 || !pool_->Fits(sizeof(T), alignof(T))) {
+            return std::allocator<T>().allocate(n);
+        }
+        if constexpr (ThreadSafe) {
+            return static_cast<T*>(AllocateCached());
+        } else {
+            return static_cast<T*>(pool_->Allocate());
+        }
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if (n != 1 || !pool_->Fits(sizeof(T), alignof(T))) {
+            std::allocator<T>().deallocate(ptr, n);
+            return;
+        }
+        if constexpr (ThreadSafe) {
+            DeallocateCached(ptr);
+        } else {
+            pool_->Deallocate(ptr);
+        }
+    }
+
+    // Освобождает слэбы пула целиком, если все live_chunks выданных блоков принадлежат вызывающему.
+    // Объекты T, не помещающиеся в блок пула, выделялись мимо него (см. allocate): тогда вызывающий
+    // не владеет ни одним блоком, и совпадение live_chunks со счётчиком пула случайно
+    bool ReleaseAll(size_t live_chunks) noexcept {
+        if (!pool_->Serves(sizeof(T), alignof(T))) {
+            return false;
+        }
+        return pool_->ReleaseAll(live_chunks);
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const SlabAllocator<U, ThreadSafe>& rhs) const noexcept {
+        return pool_ == rhs.pool_;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator!=(const SlabAllocator<U, ThreadSafe>& rhs) const noexcept {
+        return pool_ != rhs.pool_;
+    }
+
+private:
+    using FreeChunk = SlabPool::FreeChunk;
+
+    static constexpr size_t kCacheBatch = 32;
+    static constexpr size_t kCacheLimit = 2 * kCacheBatch;
+    // Столько пулов (списков) поток может использовать поочерёдно, не возвращая блоки из кэша
+    static constexpr size_t kCachedPools = 4;
+
+    // Свободные блоки одного пула, закреплённые за потоком
+    struct PoolCache {
+        void Flush() noexcept {
+            if (auto owner = pool.lock()) {
+                owner->DeallocateBatch(chunks);
+            }
+            chunks = nullptr;
+            count = 0;
+        }
+
+        std::uint64_t pool_id = 0;
+        std::weak_ptr<SlabPool> pool;
+        FreeChunk* chunks = nullptr;
+        size_t count = 0;
+    };
+
+    // Кэш потока держит блоки нескольких пулов сразу
+    struct ThreadCache {
+        ~ThreadCache() {
+            for (PoolCache& slot : slots) {
+                slot.Flush();
+            }
+        }
+
+        PoolCache* Find(std::uint64_t pool_id) noexcept {
+            for (PoolCache& slot : slots) {
+                if (slot.pool_id == pool_id) {
+                    return &slot;
+                }
+            }
+            return nullptr;
+        }
+
+        // Кэш пула pool. Если его нет, под pool занимается слот без блоков или слот уже
+        // уничтоженного пула; возвращает nullptr, если все слоты заняты другими пулами
+        PoolCache* FindOrClaim(const std::shared_ptr<SlabPool>& pool) noexcept {
+            if (PoolCache* slot = Find(pool->GetId())) {
+                return slot;
+            }
+            for (PoolCache& slot : slots) {
+                if (slot.count == 0 || slot.pool.expired()) {
+                    slot.Flush();
+                    slot.pool_id = pool->GetId();
+                    slot.pool = pool;
+                    return &slot;
+                }
+            }
+            return nullptr;
+        }
+
+        PoolCache slots[kCachedPools];
+    };
+
+    static ThreadCache& GetThreadCache() {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    // Пул, для которого у потока нет кэша, обслуживается напрямую: кэши других пулов
+    // при этом не сбрасываются
+    void* AllocateCached() {
+        PoolCache* cache = GetThreadCache().FindOrClaim(pool_);
+        if (cache == nullptr) {
+            return pool_->Allocate();
+        }
+        if (cache->chunks == nullptr) {
+            cache->count = pool_->AllocateBatch(cache->chunks, kCacheBatch);
+        }
+        FreeChunk* chunk = cache->chunks;
+        cache->chunks = chunk->next;
+        --cache->count;
+        return chunk;
+    }
+
+    void DeallocateCached(void* ptr) noexcept {
+        PoolCache* cache = GetThreadCache().Find(pool_->GetId());
+        if (cache == nullptr) {
+            pool_->Deallocate(ptr);
+            return;
+        }
+        auto* chunk = static_cast<FreeChunk*>(ptr);
+        chunk->next = cache->chunks;
+        cache->chunks = chunk;
+        if (++cache->count > kCacheLimit) {
+            // Возвращаем пулу половину кэша
+            FreeChunk* last = cache->chunks;
+            for (size_t i = 1; i < kCacheBatch; ++i) {
+                last = last->next;
+            }
+            FreeChunk* rest = last->next;
+            last->next = nullptr;
+            pool_->DeallocateBatch(rest);
+            cache->count = kCacheBatch;
+        }
+    }
+
+    std::shared_ptr<SlabPool> pool_;
+};
@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пул потоков, которые создаются один раз и переиспользуются между вызовами.
+// Используется параллельными обходами SingleLinkedList (ParallelForEach, ParallelTransform)
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threads = std::max(1u, std::thread::hardware_concurrency())) {
+        workers_.reserve(threads);
+        try {
+            for (size_t i = 0; i < threads; ++i) {
+                workers_.emplace_back([this] {
+                    WorkerLoop();
+                });
+            }
+        } catch (...) {
+            Stop();
+            throw;
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        Stop();
+    }
+
+    [[nodiscard]] size_t GetThreadCount() const noexcept {
+        return workers_.size();
+    }
+
+    // Выполняет task(0), ..., task(count - 1) в потоках пула и в вызывающем потоке и ждёт,
+    // пока выполнятся все. Первое исключение из task пробрасывается после завершения остальных задач.
+    // Нельзя вызывать из задачи этого же пула
+    template <typename Task>
+    void RunBatch(size_t count, Task&& task) {
+        if (count == 0) {
+            return;
+        }
+        Batch batch;
+        auto run = [&batch, &task, count] {
+            for (size_t i = batch.next.fetch_add(1); i < count; i = batch.next.fetch_add(1)) {
+                try {
+                    task(i);
+                } catch (...) {
+                    std::lock_guard guard(batch.mutex);
+                    if (!batch.error) {
+                        batch.error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        // Помощников не больше, чем задач сверх той, что возьмёт вызывающий поток.
+        // Если поставить помощника в очередь не удалось, его задачи выполнят остальные
+        const size_t helpers = std::min(count - 1, workers_.size());
+        {
+            std::lock_guard guard(mutex_);
+            size_t queued = 0;
+            try {
+                for (; queued < helpers; ++queued) {
+                    tasks_.emplace_back([&batch, &run] {
+                        run();
+                        std::lock_guard batch_guard(batch.mutex);
+                        if (--batch.helpers_left == 0) {
+                            batch.done.notify_one();
+                        }
+                    });
+                }
+            } catch (...) {
+            }
+            // Помощники начнут работу только после освобождения mutex_
+            batch.helpers_left = queued;
+        }
+        has_tasks_.notify_all();
+
+        run();
+        // batch живёт на стеке: ждём, пока каждый помощник перестанет к нему обращаться
+        std::unique_lock lock(batch.mutex);
+        batch.done.wait(lock, [&batch] {
+            return batch.helpers_left == 0;
+        });
+        if (batch.error) {
+            std::rethrow_exception(batch.error);
+        }
+    }
+
+private:
+    struct Batch {
+        std::atomic<size_t> next{0};
+        size_t helpers_left = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+
+    void WorkerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex_);
+                has_tasks_.wait(lock, [this] {
+                    return stopping_ || !tasks_.empty();
+                });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    void Stop() noexcept {
+        {
+            std::lock_guard guard(mutex_);
+            stopping_ = true;
+        }
+        has_tasks_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable has_tasks_;
+    bool stopping_ = false;
+};
@@ -0,0 +1,465 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Развёрнутый односвязный список: каждый узел хранит до kNodeCapacity элементов подряд,
+// а сам узел занимает NodeBytes байт (кратно кэш-линии). Интерфейс повторяет SingleLinkedList.
+// В отличие от SingleLinkedList, InsertAfter и EraseAfter перемещают элементы внутри узла,
+// поэтому делают недействительными итераторы на элементы затронутых узлов
+template <typename Type, size_t NodeBytes = 128>
+class UnrolledLinkedList {
+
+    static constexpr size_t kCacheLine = 64;
+    static_assert(NodeBytes % kCacheLine == 0, "NodeBytes must be a multiple of the cache line size");
+
+    struct Node;
+
+    // Заголовок узла. head_ состоит только из заголовка и всегда пуст
+    struct NodeBase {
+        Node* next_node = nullptr;
+        size_t count = 0;
+    };
+
+public:
+    static constexpr size_t kNodeCapacity =
+        std::max<size_t>(1, (NodeBytes - sizeof(NodeBase)) / sizeof(Type));
+    // Столько элементов хранит каждый узел, кроме последнего
+    static constexpr size_t kMinFill = kNodeCapacity / 2;
+
+private:
+    struct alignas(kCacheLine) Node : NodeBase {
+        Node() = default;
+
+        Node(const Node&) = delete;
+        Node& operator=(const Node&) = delete;
+
+        ~Node() {
+            std::destroy(Data(), Data() + this->count);
+        }
+
+        Type* Data() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+
+        alignas(Type) unsigned char storage[kNodeCapacity * sizeof(Type)];
+    };
+
+    template <typename ValueType>
+    class BasicIterator {
+
+        friend class UnrolledLinkedList;
+
+        BasicIterator(NodeBase* node, size_t index) : node_(node), index_(index) {
+        }
+
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(const BasicIterator<Type>& other) noexcept {
+            node_ = other.node_;
+            index_ = other.index_;
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        [[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept {
+            return node_ == rhs.node_ && index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        [[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept {
+            return node_ == rhs.node_ && index_ == rhs.index_;
+        }
+
+        [[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        // Переход к следующему узлу происходит раз в kNodeCapacity шагов
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            if (++index_ >= node_->count) {
+                node_ = node_->next_node;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto old_value(*this);
+            ++(*this);
+            return old_value;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            assert(node_ != nullptr && index_ < node_->count);
+            return static_cast<Node*>(node_)->Data()[index_];
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &**this;
+        }
+
+    private:
+        NodeBase* node_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    UnrolledLinkedList() = default;
+
+    template <typename InputIt>
+    UnrolledLinkedList(InputIt first, InputIt last) {
+        UnrolledLinkedList tmp;
+        NodeBase* tail = &tmp.head_;
+        for (InputIt it = first; it != last; ++it) {
+            // Заполняем узлы целиком
+            if (tail == &tmp.head_ || tail->count == kNodeCapacity) {
+                tail = tmp.LinkNodeAfter(tail, new Node());
+            }
+            Node* node = static_cast<Node*>(tail);
+            new (node->Data() + node->count) Type(*it);
+            ++node->count;
+            ++tmp.size_;
+        }
+        swap(tmp);
+    }
+
+    UnrolledLinkedList(std::initializer_list<Type> values)
+        : UnrolledLinkedList(values.begin(), values.end()) {
+    }
+
+    UnrolledLinkedList(const UnrolledLinkedList& other)
+        : UnrolledLinkedList(other.begin(), other.end()) {
+    }
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& rhs) {
+        if (this != &rhs) {
+            auto tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    ~UnrolledLinkedList() {
+        Clear();
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator{head_.next_node, 0};
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator{nullptr, 0};
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator{head_.next_node, 0};
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator{nullptr, 0};
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    // Итератор на head_: ++ переводит его на первый элемент, так как head_ пуст
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator{&head_, 0};
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator{const_cast<NodeBase*>(&head_), 0};
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    void PushFront(const Type& value) {
+        InsertAfter(before_begin(), value);
+    }
+
+    void PushFront(Type&& value) {
+        InsertAfter(before_begin(), std::move(value));
+    }
+
+    void PopFront() noexcept {
+        if (head_.next_node != nullptr) {
+            EraseAfter(before_begin());
+        }
+    }
+
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    // Удаляет элемент после pos и возвращает итератор на следующий за ним.
+    // Узел, заполненный меньше чем наполовину, сливается с соседом или забирает у следующего
+    // узла недостающие элементы: все узлы, кроме последнего, остаются заполнены хотя бы наполовину
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ != nullptr);
+        NodeBase* prev = pos.node_;
+        Node* node = nullptr;
+        size_t index = 0;
+        if (pos.index_ + 1 < prev->count) {
+            node = static_cast<Node*>(prev);
+            index = pos.index_ + 1;
+        } else {
+            node = prev->next_node;
+        }
+        if (node == nullptr) {
+            return end();
+        }
+
+        Type* data = node->Data();
+        std::move(data + index + 1, data + node->count, data + index);
+        std::destroy_at(data + node->count - 1);
+        --node->count;
+        --size_;
+
+        if (node->count == 0) {
+            // Опустевший узел может быть только следующим после pos
+            prev->next_node = node->next_node;
+            delete node;
+            return Iterator{prev->next_node, 0};
+        }
+
+        if (node->count < kMinFill) {
+            Node* next = node->next_node;
+            if (next != nullptr) {
+                if (node->count + next->count <= kNodeCapacity) {
+                    MergeNext(node);
+                } else {
+                    MoveFromNext(node, kMinFill - node->count);
+                }
+            } else if (prev != node && prev != &head_ && prev->count + node->count <= kNodeCapacity) {
+                // Последний узел сливается с предыдущим, если тот известен
+                Node* previous = static_cast<Node*>(prev);
+                const size_t offset = previous->count;
+                MergeNext(previous);
+                if (offset + index < previous->count) {
+                    return Iterator{previous, offset + index};
+                }
+                return end();
+            }
+        }
+
+        if (index < node->count) {
+            return Iterator{node, index};
+        }
+        return Iterator{node->next_node, 0};
+    }
+
+    void Clear() noexcept {
+        while (head_.next_node != nullptr) {
+            Node* tmp = head_.next_node;
+            head_.next_node = tmp->next_node;
+            delete tmp;
+        }
+        size_ = 0;
+    }
+
+    void swap(UnrolledLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    // Новый узел из одного элемента появляется только в конце списка;
+    // в остальных случаях полный узел делится пополам, сохраняя заполненность узлов
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_ != nullptr);
+        // Элемент встаёт в узел node на позицию index, before — узел перед node
+        NodeBase* before = &head_;
+        Node* node = head_.next_node;
+        size_t index = 0;
+        if (pos.node_ != &head_) {
+            before = nullptr;
+            node = static_cast<Node*>(pos.node_);
+            index = pos.index_ + 1;
+            // Вставка за последним элементом полного узла переносится в начало следующего.
+            // Так последовательное добавление в конец оставляет узлы заполненными
+            if (index == kNodeCapacity && node->next_node != nullptr) {
+                before = node;
+                node = node->next_node;
+                index = 0;
+            }
+        }
+
+        if (node == nullptr || index == kNodeCapacity) {
+            return EmplaceIntoNewNode(node == nullptr ? before : node, std::forward<Args>(args)...);
+        }
+        if (node->count < kNodeCapacity) {
+            return EmplaceInto(node, index, std::forward<Args>(args)...);
+        }
+        if constexpr (kNodeCapacity == 1) {
+            // Узел из одного элемента не поделить: новый узел встаёт перед node
+            return EmplaceIntoNewNode(before, std::forward<Args>(args)...);
+        }
+
+        // Полный узел делится пополам
+        auto split = std::make_unique<Node>();
+        const size_t half = kNodeCapacity / 2;
+        Type* data = node->Data();
+        std::uninitialized_move(data + half, data + node->count, split->Data());
+        std::destroy(data + half, data + node->count);
+        split->count = node->count - half;
+        node->count = half;
+        Node* fresh = LinkNodeAfter(node, split.release());
+
+        if (index <= half) {
+            return EmplaceInto(node, index, std::forward<Args>(args)...);
+        }
+        return EmplaceInto(fresh, index - half, std::forward<Args>(args)...);
+    }
+
+    // Переносит все элементы следующего узла в конец node и удаляет следующий узел
+    void MergeNext(Node* node) noexcept {
+        Node* next = node->next_node;
+        assert(next != nullptr && node->count + next->count <= kNodeCapacity);
+        Type* next_data = next->Data();
+        std::uninitialized_move(next_data, next_data + next->count, node->Data() + node->count);
+        node->count += next->count;
+        node->next_node = next->next_node;
+        delete next;
+    }
+
+    // Переносит count первых элементов следующего узла в конец node
+    void MoveFromNext(Node* node, size_t count) noexcept {
+        Node* next = node->next_node;
+        assert(next != nullptr && count < next->count && node->count + count <= kNodeCapacity);
+        Type* next_data = next->Data();
+        std::uninitialized_move(next_data, next_data + count, node->Data() + node->count);
+        node->count += count;
+        std::move(next_data + count, next_data + next->count, next_data);
+        std::destroy(next_data + next->count - count, next_data + next->count);
+        next->count -= count;
+    }
+
+    // Вставляет элемент в узел со свободным местом на позицию index
+    template <typename... Args>
+    Iterator EmplaceInto(Node* node, size_t index, Args&&... args) {
+        assert(node->count < kNodeCapacity && index <= node->count);
+        Type* data = node->Data();
+        if (index == node->count) {
+            new (data + index) Type(std::forward<Args>(args)...);
+        } else {
+            Type value(std::forward<Args>(args)...);
+            new (data + node->count) Type(std::move(data[node->count - 1]));
+            std::move_backward(data + index, data + node->count - 1, data + node->count);
+            data[index] = std::move(value);
+        }
+        ++node->count;
+        ++size_;
+        return Iterator{node, index};
+    }
+
+    // Создаёт узел из одного элемента и вставляет его после prev
+    template <typename... Args>
+    Iterator EmplaceIntoNewNode(NodeBase* prev, Args&&... args) {
+        auto node = std::make_unique<Node>();
+        new (node->Data()) Type(std::forward<Args>(args)...);
+        node->count = 1;
+        ++size_;
+        return Iterator{LinkNodeAfter(prev, node.release()), 0};
+    }
+
+    Node* LinkNodeAfter(NodeBase* prev, Node* node) noexcept {
+        node->next_node = prev->next_node;
+        prev->next_node = node;
+        return node;
+    }
+
+    NodeBase head_;
+    size_t size_ = 0;
+};
+
+template <typename Type, size_t NodeBytes>
+void swap(UnrolledLinkedList<Type, NodeBytes>& lhs, UnrolledLinkedList<Type, NodeBytes>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t NodeBytes>
+bool operator==(const UnrolledLinkedList<Type, NodeBytes>& lhs, const UnrolledLinkedList<Type, NodeBytes>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+template <typename Type, size_t NodeBytes>
+bool operator!=(const UnrolledLinkedList<Type, NodeBytes>& lhs, const UnrolledLinkedList<Type, NodeBytes>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t NodeBytes>
+bool operator<(const UnrolledLinkedList<Type, NodeBytes>& lhs, const UnrolledLinkedList<Type, NodeBytes>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+template <typename Type, size_t NodeBytes>
+bool operator<=(const UnrolledLinkedList<Type, NodeBytes>& lhs, const UnrolledLinkedList<Type, NodeBytes>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t NodeBytes>
+bool operator>(const UnrolledLinkedList<Type, NodeBytes>& lhs, const UnrolledLinkedList<Type, NodeBytes>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t NodeBytes>
+bool operator>=(const UnrolledLinkedList<Type, NodeBytes>& lhs, const UnrolledLinkedList<Type, NodeBytes>& rhs) {
+    return !(lhs < rhs);
+}